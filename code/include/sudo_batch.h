@@ -0,0 +1,38 @@
+/*
+ *  This library defines a multi-board lane solver on behalf of SUDO.
+ *
+ *  Boards are loaded into the lanes of a struct-of-arrays layout: for each cell, one vector holds
+ *  that cell's candidate mask in every lane.  Each sweep removes naked singles from their peers
+ *  and fills in hidden singles for every lane at once.  A lane that solves its board, proves it
+ *  has no solution, or stalls is retired and refilled with the next board from the input.
+ *  Stalled boards are finished by the scalar bitboard solver.
+ *
+ *  The vectors use the compiler's generic vector extension and the sweep is built for each ISA
+ *  SUDO_DISPATCH supports, so one binary runs it as AVX2 (one 256-bit op per vector), SSE4.2 or
+ *  SSE2 (two 128-bit ops), or plain scalar code, whichever the host CPU supports.
+ */
+
+#ifndef __SUDO_BATCH__
+#define __SUDO_BATCH__
+
+// SUDO_BATCH_LANES
+#define SUDO_BATCH_LANES 16  // Boards solved at once: 16-bit masks in a 256-bit vector
+
+/*
+ *  Description:
+ *      Solve many game boards in place, SUDO_BATCH_LANES at a time.
+ *
+ *  Args:
+ *      boards: Pointers to num_boards fixed-size arrays of 81 characters, such as the ones
+ *          create_board() returns.  Each character must be a SUDO_EMPTY_GRID or number ranging
+ *          from 1-9, inclusive.
+ *      num_boards: The number of boards.
+ *      results: [Optional Out] num_boards results: ENOERR for a solved board, ENODATA for a
+ *          board with no solution, EINVAL for a NULL or invalid board.
+ *
+ *  Returns:
+ *      ENOERR if every board was solved, ENODATA if at least one was not, EINVAL for bad input.
+ */
+int solve_batch(char *boards[], int num_boards, int results[]);
+
+#endif  /* __SUDO_BATCH__ */
@@ -0,0 +1,99 @@
+/*
+ *  This library defines a bitboard representation and solver on behalf of SUDO.
+ *
+ *  A bitboard keeps one 81-bit cell set (a 128-bit plane) per digit holding the cells where that
+ *  digit is placed or still a candidate, plus a plane of the unsolved cells.  Placing a digit
+ *  clears it from every peer with one AND-NOT against the precomputed peer set, and counting a
+ *  digit's slots in a unit is a masked popcount against the precomputed unit set.  Game boards
+ *  are only converted at the API boundary.
+ */
+
+#ifndef __SUDO_BITBOARD__
+#define __SUDO_BITBOARD__
+
+#include "sudo_cellset.h"                   // sudo_cellset_t
+
+/*
+ *  Bitboard for a single game board.  The struct is 160 bytes and self-contained so branches
+ *  may copy it by assignment.
+ */
+typedef struct
+{
+    sudo_cellset_t digits[9];  // Cells where digit index (digit - 1) is placed or a candidate
+    sudo_cellset_t unsolved;   // Cells without a placed digit
+} sudo_bitboard_t;
+
+/*
+ *  Description:
+ *      Copy the bitboard's placed digits into a game board.
+ *
+ *  Args:
+ *      bitboard: The bitboard to export.
+ *      board: [Out] A fixed-size array of 81 characters.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int export_sudo_bitboard(const sudo_bitboard_t *bitboard, char board[81]);
+
+/*
+ *  Description:
+ *      Initialize a bitboard from a game board.  This function does not validate the board's
+ *      characters.
+ *
+ *  Args:
+ *      bitboard: [Out] The bitboard to initialize.
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or a board with duplicate entries.
+ */
+int init_sudo_bitboard(sudo_bitboard_t *bitboard, const char board[81]);
+
+/*
+ *  Description:
+ *      Place digit in cell: clear the cell from every other digit's plane, clear the cell's peers
+ *      from the digit's plane, and mark the cell solved.
+ *
+ *  Args:
+ *      bitboard: The bitboard to update.
+ *      cell: The index of an unsolved cell, 0-80.
+ *      digit: The digit to place, 1-9.  Must be a candidate for cell.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or an illegal play.
+ */
+int place_sudo_bitboard(sudo_bitboard_t *bitboard, int cell, int digit);
+
+/*
+ *  Description:
+ *      Make naked and hidden single plays until there are none left.  Naked singles for the
+ *      whole board are found at once by counting the digit planes with two accumulators.
+ *
+ *  Args:
+ *      bitboard: The bitboard to update.
+ *      num_plays: [Optional Out] The number of plays made.
+ *
+ *  Returns:
+ *      ENOERR if propagation reached a fixed point (or solved the board), ENODATA if it found a
+ *      contradiction, EINVAL for bad input.
+ */
+int propagate_sudo_bitboard(sudo_bitboard_t *bitboard, int *num_plays);
+
+/*
+ *  Description:
+ *      Solve a game board in place with the bitboard: propagate singles, then branch on the
+ *      unsolved cell with the fewest candidates, copying the bitboard for each branch.
+ *
+ *  Args:
+ *      board: [In/Out] A fixed-size array of 81 characters.  Each character must be a
+ *          SUDO_EMPTY_GRID or number ranging from 1-9, inclusive.
+ *      num_nodes: [Optional Out] The number of search nodes visited.
+ *
+ *  Returns:
+ *      ENOERR on success, ENODATA if the board has no solution, EINVAL for bad input.
+ */
+int solve_bitboard(char board[81], int *num_nodes);
+
+#endif  /* __SUDO_BITBOARD__ */
@@ -0,0 +1,120 @@
+/*
+ *  This library defines an 81-bit set of cells on behalf of SUDO's strategies.
+ *
+ *  Cell n is bit (n % 64) of word (n / 64), so set operations over the whole board are two word
+ *  operations.  These are static inline so they compile down to those operations.
+ */
+
+#ifndef __SUDO_CELLSET__
+#define __SUDO_CELLSET__
+
+#include <stdbool.h>                        // bool
+#include <stdint.h>                         // uint64_t
+#include "sudo_macros.h"                    // SUDO_CTZ(), SUDO_POPCOUNT()
+
+/*
+ *  A set of cells, 0-80.
+ */
+typedef struct
+{
+    uint64_t bits[2];  // Cells 0-63, then cells 64-80
+} sudo_cellset_t;
+
+// SUDO_CELLSET_ADD
+#define SUDO_CELLSET_ADD(set, cell) ((set).bits[(cell) >> 6] |= (1ULL << ((cell) & 63)))  // Add
+// SUDO_CELLSET_DEL
+#define SUDO_CELLSET_DEL(set, cell) ((set).bits[(cell) >> 6] &= ~(1ULL << ((cell) & 63)))  // Remove
+// SUDO_CELLSET_HAS
+#define SUDO_CELLSET_HAS(set, cell) (0 != ((set).bits[(cell) >> 6] & (1ULL << ((cell) & 63))))
+
+/*
+ *  Description:
+ *      Intersect two cell sets.
+ *
+ *  Returns:
+ *      The cells in both a and b.
+ */
+static inline sudo_cellset_t and_sudo_cellset(sudo_cellset_t a, sudo_cellset_t b)
+{
+    sudo_cellset_t result = { { a.bits[0] & b.bits[0], a.bits[1] & b.bits[1] } };
+    return result;
+}
+
+/*
+ *  Description:
+ *      Subtract one cell set from another.
+ *
+ *  Returns:
+ *      The cells in a but not in b.
+ */
+static inline sudo_cellset_t andnot_sudo_cellset(sudo_cellset_t a, sudo_cellset_t b)
+{
+    sudo_cellset_t result = { { a.bits[0] & ~b.bits[0], a.bits[1] & ~b.bits[1] } };
+    return result;
+}
+
+/*
+ *  Description:
+ *      Count the cells in a cell set.
+ *
+ *  Returns:
+ *      The number of cells in set.
+ */
+static inline int count_sudo_cellset(sudo_cellset_t set)
+{
+    return SUDO_POPCOUNT(set.bits[0]) + SUDO_POPCOUNT(set.bits[1]);
+}
+
+/*
+ *  Description:
+ *      Is the cell set empty?
+ *
+ *  Returns:
+ *      True if no cells are in set, false otherwise.
+ */
+static inline bool is_empty_sudo_cellset(sudo_cellset_t set)
+{
+    return 0 == (set.bits[0] | set.bits[1]);
+}
+
+/*
+ *  Description:
+ *      Unite two cell sets.
+ *
+ *  Returns:
+ *      The cells in a or b.
+ */
+static inline sudo_cellset_t or_sudo_cellset(sudo_cellset_t a, sudo_cellset_t b)
+{
+    sudo_cellset_t result = { { a.bits[0] | b.bits[0], a.bits[1] | b.bits[1] } };
+    return result;
+}
+
+/*
+ *  Description:
+ *      Remove the lowest cell from a cell set.
+ *
+ *  Args:
+ *      set: [In/Out] The cell set to pop from.
+ *
+ *  Returns:
+ *      The cell index, 0-80, or -1 if set was empty.
+ */
+static inline int pop_sudo_cellset(sudo_cellset_t *set)
+{
+    int cell = -1;  // Lowest cell in set
+
+    if (set->bits[0])
+    {
+        cell = SUDO_CTZ(set->bits[0]);
+        set->bits[0] &= set->bits[0] - 1;
+    }
+    else if (set->bits[1])
+    {
+        cell = 64 + SUDO_CTZ(set->bits[1]);
+        set->bits[1] &= set->bits[1] - 1;
+    }
+    return cell;
+}
+
+#endif  /* __SUDO_CELLSET__ */
@@ -0,0 +1,52 @@
+/*
+ *  This library defines the single-digit chain (simple coloring, X-Chain) strategies on behalf of
+ *  SUDO.
+ */
+
+#ifndef __SUDO_CHAINS__
+#define __SUDO_CHAINS__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_MAX_CHAIN
+#define SUDO_MAX_CHAIN 16  // Most links an X-Chain search will follow from its starting cell
+
+/*
+ *  Running totals for the chain strategies.  The caller owns these and solve_chains() only ever
+ *  adds to them.
+ */
+typedef struct
+{
+    int calls;            // Number of times solve_chains() ran
+    int coloring_elims;   // Candidates eliminated by simple coloring
+    int xchain_elims;     // Candidates eliminated by X-Chains
+    int nodes_visited;    // Strong-link graph nodes visited by the X-Chain search
+} sudo_chain_counters_t;
+
+/*
+ *  Description:
+ *      Make single-digit chain eliminations using the state's strong links.  Simple coloring is
+ *      tried first, then X-Chains, stopping after the first that makes progress.  This function
+ *      does not validate the solver state.
+ *
+ *  Notes:
+ *      SIMPLE COLORING: Color the cells of each connected group of strong links for a digit in
+ *          alternating colors.  Exactly one color holds the digit.  If two cells of one color see
+ *          each other, that color is false.  Any other cell that sees both colors can't hold it.
+ *      X-CHAIN: Assume a cell doesn't hold the digit and follow strong links (then one of the
+ *          pair is on) and weak links (then its peers are off), at most SUDO_MAX_CHAIN links.
+ *          Every cell that ends up on pairs with the start: cells that see both can't hold it.
+ *          If the start ends up on, it must hold the digit.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      counters: [Optional In/Out] Running totals to add to.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_chains(sudo_state_t *state, sudo_chain_counters_t *counters, int *num_elims);
+
+#endif  /* __SUDO_CHAINS__ */
@@ -0,0 +1,73 @@
+/*
+ *  This library defines a Dancing Links (Algorithm X) exact cover solver on behalf of SUDO.
+ *
+ *  The board is modeled as 729 rows (one per cell and digit) covering 324 constraint columns: each
+ *  cell holds a digit, and each row, col, and 3x3 grid holds each digit.  The node arena is a
+ *  fixed-size thread-local table linked up once per thread on first use.  Every call covers the
+ *  givens, searches, and then uncovers everything, leaving the arena ready for the next board.
+ *  Solves on different threads never share an arena, but a callback must not start another DLX
+ *  solve on its own thread: these functions are not reentrant.
+ */
+
+#ifndef __SUDO_DLX__
+#define __SUDO_DLX__
+
+/*
+ *  Description:
+ *      Called with each solution found by enumerate_dlx_solutions().
+ *
+ *  Args:
+ *      solution: A solved game board of 81 characters.  Only valid for the duration of the call.
+ *      context: The caller's context pointer.
+ *
+ *  Returns:
+ *      ENOERR to keep enumerating, anything else to stop.
+ */
+typedef int (*sudo_dlx_callback_t)(const char solution[81], void *context);
+
+/*
+ *  Description:
+ *      Count the solutions to a game board, stopping at limit.
+ *
+ *  Args:
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *      limit: Stop counting once this many solutions have been found.  Must be positive.
+ *      num_solutions: [Out] The number of solutions found, 0 through limit.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int count_dlx_solutions(const char board[81], int limit, int *num_solutions);
+
+/*
+ *  Description:
+ *      Find every solution to a game board, passing each one to callback.
+ *
+ *  Args:
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *      callback: Called with each solution.  Enumeration stops early if it returns an error.
+ *      context: [Optional] Passed through to callback.
+ *      num_solutions: [Optional Out] The number of solutions passed to callback.
+ *
+ *  Returns:
+ *      ENOERR on success (including early stops), EINVAL for bad input.
+ */
+int enumerate_dlx_solutions(const char board[81], sudo_dlx_callback_t callback, void *context,
+                            int *num_solutions);
+
+/*
+ *  Description:
+ *      Solve a game board in place with the first solution found.
+ *
+ *  Args:
+ *      board: [In/Out] A fixed-size array of 81 characters.  Each character must be a
+ *          SUDO_EMPTY_GRID or number ranging from 1-9, inclusive.
+ *
+ *  Returns:
+ *      ENOERR on success, ENODATA if the board has no solution, EINVAL for bad input.
+ */
+int find_dlx_solution(char board[81]);
+
+#endif  /* __SUDO_DLX__ */
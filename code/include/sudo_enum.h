@@ -0,0 +1,76 @@
+/*
+ *  This library defines a lazy solution enumerator on behalf of SUDO.
+ *
+ *  The enumerator walks the same search tree as count_search() one solution at a time: each
+ *  call to next_sudo_enum() resumes the depth-first search where the last one stopped and
+ *  returns as soon as it reaches the next solution.  The search stack is fixed-size (one branch
+ *  cell and untried candidate mask per level, 81 levels at most) and failed branches are undone
+ *  with the state's trail, so nothing is allocated and nothing is collected.  Memory use is
+ *  constant no matter how many solutions are streamed.
+ */
+
+#ifndef __SUDO_ENUM__
+#define __SUDO_ENUM__
+
+#include <stdbool.h>                        // bool
+#include <stdint.h>                         // uint8_t, uint16_t
+#include "sudo_state.h"                     // sudo_state_t, sudo_trail_t
+
+/*
+ *  Enumerator for a single game board.  It records into its own trail, so it must not be
+ *  copied or moved once initialized.
+ */
+typedef struct
+{
+    sudo_state_t state;         // The search's current node
+    sudo_trail_t trail;         // Undo log for state, one level per open branch
+    uint8_t cells[81];          // Branch cell of each open level
+    uint16_t untried[81];       // Candidates of cells[level] not tried yet
+    int depth;                  // Number of open levels
+    bool at_solution;           // Is state the solution the last call returned?
+    bool done;                  // Has the whole tree been searched?
+    long long num_solutions;    // Number of solutions returned so far
+} sudo_enum_t;
+
+/*
+ *  Description:
+ *      Stop an enumeration.  The enumerator may be initialized again afterwards.
+ *
+ *  Args:
+ *      iter: The enumerator.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int destroy_sudo_enum(sudo_enum_t *iter);
+
+/*
+ *  Description:
+ *      Start enumerating a game board's solutions.  The board is validated and copied, so the
+ *      caller may reuse it right away.
+ *
+ *  Args:
+ *      iter: [Out] The enumerator to initialize.
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or an invalid game board.
+ */
+int init_sudo_enum(sudo_enum_t *iter, const char board[81]);
+
+/*
+ *  Description:
+ *      Find the next solution.  Solutions come out in a fixed order, each exactly once.
+ *
+ *  Args:
+ *      iter: The enumerator.
+ *      solution: [Out] A fixed-size array of 81 characters for the solution.
+ *
+ *  Returns:
+ *      ENOERR with the next solution, ENODATA once every solution has been returned (and on
+ *      every call after that), EINVAL for bad input.
+ */
+int next_sudo_enum(sudo_enum_t *iter, char solution[81]);
+
+#endif  /* __SUDO_ENUM__ */
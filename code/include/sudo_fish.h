@@ -0,0 +1,35 @@
+/*
+ *  This library defines the basic fish (X-Wing, Swordfish, Jellyfish) strategy on behalf of SUDO.
+ */
+
+#ifndef __SUDO_FISH__
+#define __SUDO_FISH__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_MAX_FISH
+#define SUDO_MAX_FISH 4  // Largest fish (Jellyfish) to look for
+
+/*
+ *  Description:
+ *      Make basic fish eliminations for every digit, using rows as base sets and cols as cover
+ *      sets and then the other way around.  Sizes are tried from 2 (X-Wing) through max_size,
+ *      stopping after the first size that makes progress.  This function does not validate the
+ *      solver state.
+ *
+ *  Notes:
+ *      If a digit's slots in N rows all lie within N cols, the digit must go in those cols in
+ *      one of those rows, so it can't go anywhere else in those cols (and vice versa).
+ *
+ *  Args:
+ *      state: The solver state.
+ *      max_size: The largest fish to look for, 2 through SUDO_MAX_FISH.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_fish(sudo_state_t *state, int max_size, int *num_elims);
+
+#endif  /* __SUDO_FISH__ */
@@ -0,0 +1,36 @@
+/*
+ *  This library defines the forcing chain strategy on behalf of SUDO.
+ */
+
+#ifndef __SUDO_FORCING__
+#define __SUDO_FORCING__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_FORCING_BUDGET
+#define SUDO_FORCING_BUDGET 81  // Default number of plays each branch may propagate
+
+/*
+ *  Description:
+ *      Make forcing chain eliminations.  Each bivalue cell (one of two digits) and each bilocal
+ *      unit (one of two slots for a digit) is a pair of branches.  Each branch is played out on
+ *      a copy of the solver state by propagating singles, at most budget plays.  A branch that
+ *      ends in a contradiction is refuted.  Otherwise, a candidate that neither branch left
+ *      standing is eliminated.  Stops after the first pair that makes progress.  This function
+ *      does not validate the solver state.
+ *
+ *  Notes:
+ *      Branches are struct copies of the fixed-size solver state, so no memory is allocated.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      budget: The most plays each branch may propagate.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_forcing(sudo_state_t *state, int budget, int *num_elims);
+
+#endif  /* __SUDO_FORCING__ */
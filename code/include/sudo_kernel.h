@@ -0,0 +1,292 @@
+/*
+ *  This library defines the unchecked inner-loop kernels used by SUDO's game logic.
+ *
+ *  The public entry points validate their input once.  Past that point the solver only ever
+ *  hands these kernels cell indices, digits, and states it produced itself, so they skip range
+ *  checks, NULL checks, and errno out-parameters entirely.  Their preconditions are assertions
+ *  that only compile in when SUDO_DEBUG is defined.
+ *
+ *  The write kernels are the whole of a placement: the cell, its units, and its 20 peers.  They
+ *  are static inline so each caller (itself built per ISA with SUDO_DISPATCH) gets them inlined
+ *  with no call, no error path, and no per-peer revalidation.
+ */
+
+#ifndef __SUDO_KERNEL__
+#define __SUDO_KERNEL__
+
+#include <stdbool.h>                        // bool
+#include <stddef.h>                         // NULL, size_t
+#include <stdint.h>                         // uint16_t
+#include <string.h>                         // memchr()
+#include "sudo_macros.h"                    // SUDO_BOARD_LEN, SUDO_CTZ(), SUDO_POPCOUNT()
+#include "sudo_state.h"                     // sudo_state_t, sudo_cell_units, sudo_peers
+
+/* KERNEL MACROS */
+// SUDO_KERNEL_ASSERT
+#ifdef SUDO_DEBUG
+    #include <assert.h>                     // assert()
+    #define SUDO_KERNEL_ASSERT(cond) assert(cond)  // Debug builds check kernel preconditions
+#else
+    #define SUDO_KERNEL_ASSERT(cond) ((void)0)  // Release builds trust the caller
+#endif  /* SUDO_KERNEL_ASSERT */
+
+/* TRAIL MACROS */
+// SUDO_TRAIL_CANDS, SUDO_TRAIL_CELLS, SUDO_TRAIL_USED, SUDO_TRAIL_POS
+#define SUDO_TRAIL_CANDS(cell) (cell)                                  // cands[cell]
+#define SUDO_TRAIL_CELLS(cell) (81 + (cell))                           // cells[cell]
+#define SUDO_TRAIL_USED(unit) (162 + (unit))                           // unit_used[unit]
+#define SUDO_TRAIL_POS(unit, digit) (189 + ((unit) * 9) + (digit) - 1)  // unit_pos[unit][digit - 1]
+
+/*
+ *  Description:
+ *      The digit an empty cell is down to, if it's down to one.
+ *
+ *  Args:
+ *      state: A solver state.
+ *      cell: A cell index, 0-80.
+ *
+ *  Returns:
+ *      The cell's only candidate, 1-9, or 0 if the cell has zero or several candidates (or is
+ *      already filled in, since placed cells have no candidates).
+ */
+static inline int get_sudo_single(const sudo_state_t *state, int cell)
+{
+    SUDO_KERNEL_ASSERT(NULL != state && cell >= 0 && cell < SUDO_BOARD_LEN);
+    uint16_t cands = state->cands[cell];  // The cell's candidates
+    return (0 != cands && 0 == (cands & (cands - 1))) ? SUDO_CTZ(cands) + 1 : 0;
+}
+
+/*
+ *  Description:
+ *      Is the cell empty?
+ *
+ *  Args:
+ *      state: A solver state.
+ *      cell: A cell index, 0-80.
+ *
+ *  Returns:
+ *      True if no digit has been placed in cell, false otherwise.
+ */
+static inline bool is_empty_sudo_cell(const sudo_state_t *state, int cell)
+{
+    SUDO_KERNEL_ASSERT(NULL != state && cell >= 0 && cell < SUDO_BOARD_LEN);
+    return 0 == state->cells[cell];
+}
+
+/*
+ *  Description:
+ *      Is every position of a game board filled in?  The board must already be validated.
+ *
+ *  Args:
+ *      board: A fixed-size array of 81 characters.
+ *
+ *  Returns:
+ *      True if the board has no SUDO_EMPTY_GRID, false otherwise.
+ */
+static inline bool is_full_sudo_board(const char board[81])
+{
+    SUDO_KERNEL_ASSERT(NULL != board);
+    return NULL == memchr(board, SUDO_EMPTY_GRID, SUDO_BOARD_LEN);
+}
+
+/*
+ *  Description:
+ *      Log the old value of a mask or cell that is about to change, if the state is recording
+ *      and an undo level is open.  SUDO_TRAIL_LEN bounds every path, so there is no overflow
+ *      check outside of debug builds.
+ *
+ *  Args:
+ *      state: The solver state about to change.
+ *      index: A SUDO_TRAIL_*() index naming the mask or cell.
+ *      value: Its current value.
+ *
+ *  Returns:
+ *      None
+ */
+static inline void log_sudo_trail(sudo_state_t *state, int index, uint16_t value)
+{
+    sudo_trail_t *trail = state->trail;  // The state's undo log
+    if (NULL != trail && state == trail->owner && trail->depth > 0)
+    {
+        SUDO_KERNEL_ASSERT(trail->len < SUDO_TRAIL_LEN);
+        trail->entries[trail->len].index = index;
+        trail->entries[trail->len].value = value;
+        trail->len++;
+    }
+}
+
+/*
+ *  Description:
+ *      Record the new size of cell's candidate mask: queue singles and flag contradictions.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The index of an empty cell whose candidate mask just changed.
+ *
+ *  Returns:
+ *      None
+ */
+static inline void check_sudo_cands(sudo_state_t *state, int cell)
+{
+    SUDO_KERNEL_ASSERT(cell >= 0 && cell < SUDO_BOARD_LEN);
+    uint16_t cands = state->cands[cell];  // The cell's candidates
+    if (0 == cands)
+    {
+        state->contradiction = true;  // Nothing can go here
+    }
+    else if (0 == (cands & (cands - 1)))
+    {
+        state->single_queue[state->single_tail] = cell;  // Only one thing can go here
+        state->single_tail++;
+    }
+}
+
+/*
+ *  Description:
+ *      Record the new size of a unit's slot mask for digit: queue hidden singles, track strong
+ *      links, and flag contradictions.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      unit: The unit index, 0-26.
+ *      digit: The digit, 1-9, whose slot mask just changed.
+ *
+ *  Returns:
+ *      None
+ */
+static inline void check_sudo_slots(sudo_state_t *state, int unit, int digit)
+{
+    SUDO_KERNEL_ASSERT(unit >= 0 && unit < SUDO_NUM_UNITS && digit >= 1 && digit <= 9);
+    if (0 == (state->unit_used[unit] & SUDO_DIGIT_BIT(digit)))
+    {
+        state->strong_units[digit - 1] &= ~(1UL << unit);
+        switch (SUDO_POPCOUNT(state->unit_pos[unit][digit - 1]))
+        {
+            case 0:
+                state->contradiction = true;  // The digit can't go anywhere in this unit
+                break;
+            case 1:
+                // The digit can only go one place in this unit
+                state->hidden_queue[state->hidden_tail] = (unit * 9) + (digit - 1);
+                state->hidden_tail++;
+                break;
+            case 2:
+                state->strong_units[digit - 1] |= 1UL << unit;  // A conjugate pair
+                break;
+            default:
+                break;  // Nothing to do yet
+        }
+    }
+}
+
+/*
+ *  Description:
+ *      Remove slot from unit's slot mask for digit.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      unit: The unit index, 0-26.
+ *      slot: The slot index within unit, 0-8.
+ *      digit: The digit, 1-9.
+ *
+ *  Returns:
+ *      None
+ */
+static inline void clear_sudo_slot(sudo_state_t *state, int unit, int slot, int digit)
+{
+    SUDO_KERNEL_ASSERT(slot >= 0 && slot < 9);
+    uint16_t *slots = &(state->unit_pos[unit][digit - 1]);  // Slot mask to update
+    if (*slots & (1 << slot))
+    {
+        log_sudo_trail(state, SUDO_TRAIL_POS(unit, digit), *slots);
+        *slots &= ~(1 << slot);
+        check_sudo_slots(state, unit, digit);
+    }
+}
+
+/*
+ *  Description:
+ *      remove_sudo_candidate() without the input validation.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The cell index, 0-80.
+ *      digit: The candidate to remove, 1-9.
+ *
+ *  Returns:
+ *      True if the candidate was removed, false if it was not a candidate.
+ */
+static inline bool eliminate_sudo_candidate(sudo_state_t *state, int cell, int digit)
+{
+    SUDO_KERNEL_ASSERT(NULL != state && cell >= 0 && cell < SUDO_BOARD_LEN);
+    SUDO_KERNEL_ASSERT(digit >= 1 && digit <= 9);
+    uint16_t bit = SUDO_DIGIT_BIT(digit);  // Mask bit for digit
+    if (0 == (state->cands[cell] & bit))
+    {
+        return false;  // Nothing to remove
+    }
+    log_sudo_trail(state, SUDO_TRAIL_CANDS(cell), state->cands[cell]);
+    state->cands[cell] &= ~bit;
+    check_sudo_cands(state, cell);
+    for (int i = 0; i < 3; i++)
+    {
+        clear_sudo_slot(state, sudo_cell_units[cell][i], sudo_cell_slots[cell][i], digit);
+    }
+    return true;
+}
+
+/*
+ *  Description:
+ *      Place digit in an empty cell, mark it used in the cell's units, clear the cell from the
+ *      slot masks of its other candidates, and remove digit from its 20 peers.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The index of an empty cell, 0-80.
+ *      digit: The digit to place, 1-9.  Must be a candidate for cell.
+ *
+ *  Returns:
+ *      None
+ */
+static inline void assign_sudo_digit(sudo_state_t *state, int cell, int digit)
+{
+    SUDO_KERNEL_ASSERT(NULL != state && cell >= 0 && cell < SUDO_BOARD_LEN);
+    SUDO_KERNEL_ASSERT(digit >= 1 && digit <= 9);
+    SUDO_KERNEL_ASSERT(0 != (state->cands[cell] & SUDO_DIGIT_BIT(digit)));
+    uint16_t bit = SUDO_DIGIT_BIT(digit);          // Mask bit for digit
+    uint16_t others = state->cands[cell] & ~bit;   // The cell's other candidates
+    int unit = 0;                                  // Unit index
+    // Place it
+    log_sudo_trail(state, SUDO_TRAIL_CELLS(cell), state->cells[cell]);
+    log_sudo_trail(state, SUDO_TRAIL_CANDS(cell), state->cands[cell]);
+    state->cells[cell] = digit;
+    state->cands[cell] = 0;
+    state->num_empty--;
+    state->hash ^= sudo_zobrist[cell][digit - 1];
+    // The digit is done in this cell's units
+    for (int i = 0; i < 3; i++)
+    {
+        unit = sudo_cell_units[cell][i];
+        log_sudo_trail(state, SUDO_TRAIL_USED(unit), state->unit_used[unit]);
+        log_sudo_trail(state, SUDO_TRAIL_POS(unit, digit), state->unit_pos[unit][digit - 1]);
+        state->unit_used[unit] |= bit;
+        state->unit_pos[unit][digit - 1] = 0;
+        state->strong_units[digit - 1] &= ~(1UL << unit);
+    }
+    // The cell is no longer a slot for its other candidates
+    for (; others; others &= others - 1)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            clear_sudo_slot(state, sudo_cell_units[cell][i], sudo_cell_slots[cell][i],
+                            SUDO_CTZ(others) + 1);
+        }
+    }
+    // The digit is no longer a candidate for this cell's peers
+    for (int i = 0; i < SUDO_NUM_PEERS; i++)
+    {
+        eliminate_sudo_candidate(state, sudo_peers[cell][i], digit);
+    }
+}
+
+#endif  /* __SUDO_KERNEL__ */
@@ -0,0 +1,31 @@
+/*
+ *  This library defines the locked candidates (pointing and claiming) strategy on behalf of SUDO.
+ */
+
+#ifndef __SUDO_LOCKED__
+#define __SUDO_LOCKED__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+/*
+ *  Description:
+ *      Make box/line intersection eliminations.  This function does not validate the solver
+ *      state.
+ *
+ *  Notes:
+ *      POINTING: If a digit's slots in a 3x3 grid all lie in one row (or col), it can't go in
+ *          that row (or col) outside of the grid.
+ *      CLAIMING: If a digit's slots in a row (or col) all lie in one 3x3 grid, it can't go in
+ *          that grid outside of the row (or col).
+ *
+ *  Args:
+ *      state: The solver state.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_locked_candidates(sudo_state_t *state, int *num_elims);
+
+#endif  /* __SUDO_LOCKED__ */
@@ -5,6 +5,161 @@
 #ifndef __SUDO_LOGIC__
 #define __SUDO_LOGIC__
 
+#include <stdbool.h>                        // bool
+#include <stdint.h>                         // uint64_t
+#include "sudo_chains.h"                    // sudo_chain_counters_t
+#include "sudo_search.h"                    // sudo_restart_t
+#include "sudo_state.h"                     // sudo_state_t
+#include "sudo_ttable.h"                    // sudo_ttable_t
+
+/*
+ *  Solving engines.  The strategy engines make naked and hidden single plays first and fall back
+ *  to search (if enabled) when they stall.  The backends solve the whole board themselves.
+ */
+typedef enum
+{
+    SUDO_ENGINE_LOGIC = 0,     // Human-style strategies, cheapest first
+    SUDO_ENGINE_TEMPLATE = 1,  // Template (pattern overlay) eliminations
+    SUDO_ENGINE_DLX = 2,       // Dancing Links exact cover backend
+    SUDO_ENGINE_SAT = 3,       // CDCL SAT backend
+    SUDO_ENGINE_BITBOARD = 4,  // Bitboard propagation and search backend
+} sudo_engine_t;
+
+/*
+ *  The logic engine's strategies, in their default (cheapest first) order.
+ */
+typedef enum
+{
+    SUDO_STRATEGY_NAKED_SINGLE = 0,  // Strategy #1: a cell with one candidate left
+    SUDO_STRATEGY_HIDDEN_SINGLE,     // Strategy #2: a digit with one slot left in a unit
+    SUDO_STRATEGY_LOCKED,            // Locked candidates (pointing and claiming)
+    SUDO_STRATEGY_SUBSETS,           // Naked and hidden pairs, triples, and quads
+    SUDO_STRATEGY_FISH,              // X-Wing, Swordfish, and Jellyfish
+    SUDO_STRATEGY_WINGS,             // XY-Wing, XYZ-Wing, and W-Wing
+    SUDO_STRATEGY_CHAINS,            // Simple coloring and X-chains
+    SUDO_STRATEGY_UNIQUENESS,        // Unique Rectangles and BUG+1
+    SUDO_STRATEGY_FORCING,           // Forcing chains
+    SUDO_STRATEGY_TEMPLATE,          // Template (pattern overlay) eliminations
+    SUDO_NUM_STRATEGIES              // Number of strategies
+} sudo_strategy_id_t;
+
+/*
+ *  Rough cost classes for a strategy, used to cap how hard the logic engine works.
+ */
+typedef enum
+{
+    SUDO_COST_TRIVIAL = 0,  // Queue pops
+    SUDO_COST_LOW = 1,      // One pass over the units
+    SUDO_COST_MEDIUM = 2,   // Combinations of units or cells
+    SUDO_COST_HIGH = 3,     // Graph walks and pattern searches
+    SUDO_COST_EXTREME = 4,  // Trial propagation or enumeration
+} sudo_cost_t;
+
+typedef struct sudo_profile sudo_profile_t;  // Per-strategy statistics, see sudo_profile.h
+
+/*
+ *  Tuning knobs for solve_board_opts().  Use init_sudo_options() to get the defaults that
+ *  solve_board() uses.
+ *
+ *  The logic engine runs the strategies listed in order as a pipeline: after any progress it
+ *  restarts from the first one, so list them cheapest first.  Strategies costlier than max_cost
+ *  are skipped.  The template engine ignores order and runs the singles and then the template
+ *  strategy.  If profile is set, every stage the pipeline runs is timed and counted in it.  If
+ *  chain_counters is set, the chain strategy adds its per-technique totals to it.
+ *
+ *  Setting restart makes the search fallback randomize its ordering and restart on a schedule,
+ *  which trims the heavy tail of slow boards.  The same seed always makes the same choices.  If
+ *  search_nodes is set, the search fallback adds the number of nodes it visited to it.  If
+ *  ttable is set, the search fallback skips the subtrees it records as refuted and records new
+ *  ones, so every solve that shares the table (on any thread) learns from the others.
+ *
+ *  Setting assume_unique enables the uniqueness strategies (Unique Rectangles, BUG+1).  Those are
+ *  only sound for a board with exactly one solution: on any other board they can eliminate the
+ *  digits every solution needs.
+ */
+typedef struct
+{
+    sudo_engine_t engine;   // Solving engine
+    int fish_size;          // Largest fish (2 X-Wing, 3 Swordfish, 4 Jellyfish), 0 disables
+    int forcing_budget;     // Plays each forcing chain branch may propagate, 0 disables
+    bool assume_unique;     // The caller asserts the board has exactly one solution
+    bool search;            // Fall back to depth-first search when the engine stalls
+    sudo_restart_t restart;  // Search restart schedule, SUDO_RESTART_NONE for deterministic
+    int restart_base;       // Search nodes per unit of the restart schedule
+    uint64_t seed;          // Seeds the randomized search
+    sudo_strategy_id_t order[SUDO_NUM_STRATEGIES];  // Strategies the logic engine runs
+    int num_strategies;     // Number of entries used in order
+    sudo_cost_t max_cost;   // Skip strategies costlier than this
+    sudo_profile_t *profile;  // [Optional] Per-strategy statistics to update, NULL disables
+    sudo_chain_counters_t *chain_counters;  // [Optional] Chain strategy totals to add to
+    sudo_ttable_t *ttable;  // [Optional] Refuted search subtrees to share, NULL disables
+    uint64_t *search_nodes;  // [Optional] Search nodes visited to add to, NULL disables
+    int sat_max_learned;    // Learned clauses the SAT engine keeps, 0 for as many as fit
+} sudo_options_t;
+
+/*
+ *  Description:
+ *      Apply one strategy to the solver state.  The solver state is not validated.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if progress was made, ENODATA if none was (or the strategy is disabled by
+ *      options), or errno on error.
+ */
+typedef int (*sudo_strategy_fn_t)(sudo_state_t *state, const sudo_options_t *options,
+                                  int *num_progress);
+
+/*
+ *  A registered strategy.
+ */
+typedef struct
+{
+    const char *name;          // Human-readable name
+    sudo_cost_t cost;          // Cost class
+    sudo_strategy_fn_t apply;  // Apply it
+} sudo_strategy_t;
+
+/*
+ *  The strategy registry, indexed by sudo_strategy_id_t.
+ */
+extern const sudo_strategy_t sudo_strategies[SUDO_NUM_STRATEGIES];
+
+/*
+ *  Description:
+ *      Count a game board's solutions, stopping as soon as limit are found.  Use a limit of 2 to
+ *      check a board for a unique solution: the count comes back 0 (no solution), 1 (unique), or
+ *      2 (two or more).  The board is not modified.
+ *
+ *  Args:
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *      limit: Stop after this many solutions, at least 1.
+ *      num_solutions: [Out] The number of solutions found, 0 to limit.
+ *      witnesses: [Optional Out] Room for limit game boards.  The i-th solution found is
+ *          written to witnesses[i], so a limit of 2 returns both witnesses of a non-unique board.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or an invalid game board.
+ */
+int count_solutions(const char board[81], int limit, int *num_solutions, char witnesses[][81]);
+
+/*
+ *  Description:
+ *      Initialize solver options to their defaults.  The logic engine runs every strategy but
+ *      the template strategy, in registry order.
+ *
+ *  Args:
+ *      options: [Out] The options to initialize.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int init_sudo_options(sudo_options_t *options);
+
 /*
  *  Description:
  *      Is the game over?
@@ -31,4 +186,19 @@ int is_game_over(char board[81]);
  */
 int solve_board(char board[81]);
 
+/*
+ *  Description:
+ *      Solve a game board using the given options.  Every engine keeps its working state on the
+ *      stack or in thread-local tables, so solves on different threads never interfere.
+ *
+ *  Args:
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *      options: [Optional] Solver options.  NULL uses the defaults.
+ *
+ *  Returns:
+ *      ENOERR on success, ENODATA for an unsolved game board, or errno on error.
+ */
+int solve_board_opts(char board[81], const sudo_options_t *options);
+
 #endif  /* __SUDO_LOGIC__ */
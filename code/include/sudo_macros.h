@@ -21,4 +21,43 @@
 // SUDO_EMPTY_GRID
 #define SUDO_EMPTY_GRID ((char)' ')  // An empty grid position
 
+/* BIT MACROS */
+// SUDO_POPCOUNT, SUDO_CTZ
+#if (defined(__GNUC__) || defined(__clang__))
+    #define SUDO_POPCOUNT(mask) __builtin_popcountll((unsigned long long)(mask))  // Bits set
+    #define SUDO_CTZ(mask) __builtin_ctzll((unsigned long long)(mask))  // Index of the lowest bit
+#else
+    #define SUDO_POPCOUNT(mask) sudo_popcount((unsigned long long)(mask))  // Bits set
+    #define SUDO_CTZ(mask) sudo_ctz((unsigned long long)(mask))  // Index of the lowest bit
+    // Portable fallbacks for compilers without the builtins
+    static inline int sudo_popcount(unsigned long long mask)
+    {
+        int count = 0;  // Number of bits set
+        for (; mask; mask &= mask - 1)
+        {
+            count++;
+        }
+        return count;
+    }
+    static inline int sudo_ctz(unsigned long long mask)
+    {
+        int index = 0;  // Index of the lowest bit
+        for (; mask && !(mask & 1); mask >>= 1)
+        {
+            index++;
+        }
+        return index;
+    }
+#endif  /* SUDO_POPCOUNT, SUDO_CTZ */
+
+/* DISPATCH MACROS */
+// SUDO_DISPATCH
+// Build AVX2, SSE4.2, and baseline copies of a hot kernel and pick one once at load time (GCC
+// emits a cpuid-based ifunc resolver), so one binary uses the best ISA the host CPU supports
+#if (defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__))
+    #define SUDO_DISPATCH __attribute__((target_clones("avx2", "sse4.2", "default")))
+#else
+    #define SUDO_DISPATCH  // Baseline only
+#endif  /* SUDO_DISPATCH */
+
 #endif  /* __SUDO_MACROS__ */
@@ -0,0 +1,114 @@
+/*
+ *  This library defines per-strategy statistics and adaptive strategy ordering on behalf of SUDO.
+ *
+ *  A profile counts, for each strategy, how often the logic engine's pipeline ran it, how often
+ *  it made progress, how much progress it made, and how long it took.  Accumulate one over a
+ *  corpus (see sudo_options_t.profile), save it, and reload it later to order the pipeline by
+ *  expected progress per nanosecond for that kind of corpus.
+ */
+
+#ifndef __SUDO_PROFILE__
+#define __SUDO_PROFILE__
+
+#include <stdint.h>                         // uint64_t
+#include "sudo_logic.h"                     // sudo_options_t, sudo_profile_t, SUDO_NUM_STRATEGIES
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_PROFILE_MIN_CALLS
+#define SUDO_PROFILE_MIN_CALLS 32  // Calls a strategy needs before its statistics are trusted
+
+/*
+ *  Statistics for one strategy.
+ */
+typedef struct
+{
+    uint64_t calls;     // Number of times the strategy ran
+    uint64_t hits;      // Number of those that made progress
+    uint64_t progress;  // Plays made plus candidates eliminated
+    uint64_t ns;        // Nanoseconds spent in the strategy
+} sudo_strategy_stats_t;
+
+/*
+ *  Statistics for every strategy, indexed by sudo_strategy_id_t.
+ */
+struct sudo_profile
+{
+    sudo_strategy_stats_t stats[SUDO_NUM_STRATEGIES];
+};
+
+/*
+ *  Description:
+ *      Reorder options->order by each strategy's progress per nanosecond, best first, and drop
+ *      strategies that never made progress in at least SUDO_PROFILE_MIN_CALLS calls.  Strategies
+ *      with fewer calls than that keep their relative order after the ranked ones.  The search
+ *      fallback (options->search) still solves whatever the reordered pipeline can't.
+ *
+ *  Args:
+ *      profile: The statistics to rank by.
+ *      options: [In/Out] The solver options to reorder.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int adapt_sudo_options(const sudo_profile_t *profile, sudo_options_t *options);
+
+/*
+ *  Description:
+ *      Zero every statistic in a profile.
+ *
+ *  Args:
+ *      profile: [Out] The profile to initialize.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int init_sudo_profile(sudo_profile_t *profile);
+
+/*
+ *  Description:
+ *      Read a profile written by save_sudo_profile().  Lines for unknown strategies are ignored
+ *      and strategies without a line are zeroed.
+ *
+ *  Args:
+ *      profile: [Out] The profile to populate.
+ *      filename: The file to read.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or a malformed file, or errno from fopen().
+ */
+int load_sudo_profile(sudo_profile_t *profile, const char *filename);
+
+/*
+ *  Description:
+ *      Apply one strategy, timing it and recording the results in a profile.  The logic engine's
+ *      pipeline calls this in place of the strategy's apply function when options->profile is
+ *      set.  This function does not validate the solver state.
+ *
+ *  Args:
+ *      profile: The profile to update.
+ *      id: The strategy to apply.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
+ *
+ *  Returns:
+ *      The strategy's results, or EINVAL for bad input.
+ */
+int profile_sudo_strategy(sudo_profile_t *profile, sudo_strategy_id_t id, sudo_state_t *state,
+                          const sudo_options_t *options, int *num_progress);
+
+/*
+ *  Description:
+ *      Write a profile as text: a header line, then one "id calls hits progress ns name" line
+ *      per strategy.
+ *
+ *  Args:
+ *      profile: The profile to write.
+ *      filename: The file to (over)write.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input, or errno from fopen() or a failed write.
+ */
+int save_sudo_profile(const sudo_profile_t *profile, const char *filename);
+
+#endif  /* __SUDO_PROFILE__ */
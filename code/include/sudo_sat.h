@@ -0,0 +1,36 @@
+/*
+ *  This library defines a conflict-driven clause learning (CDCL) SAT backend on behalf of SUDO.
+ *
+ *  The board is encoded as CNF over 729 variables, one per cell and digit: each cell, and each
+ *  row, col, and 3x3 grid for each digit, holds exactly one.  "At least one" is a single clause
+ *  and "at most one" uses the sequential counter encoding (3n - 4 clauses and n - 1 auxiliary
+ *  variables per group instead of n(n - 1) / 2 pairwise clauses).  The givens are level zero
+ *  assignments.  The solver uses two watched literals, first-UIP clause learning, VSIDS-style
+ *  activity, phase saving, and Luby restarts.  Once the learned clauses fill their budget the
+ *  solver forgets them all and starts over, keeping the variable activity and every level zero
+ *  fact it has proven.
+ *
+ *  The solver lives in fixed-size thread-local tables (about 5 MB per thread that uses it) and the
+ *  CNF is encoded once per thread on first use, so solves on different threads never interfere.
+ */
+
+#ifndef __SUDO_SAT__
+#define __SUDO_SAT__
+
+/*
+ *  Description:
+ *      Solve a game board in place with the SAT backend.
+ *
+ *  Args:
+ *      board: [In/Out] A fixed-size array of 81 characters.  Each character must be a
+ *          SUDO_EMPTY_GRID or number ranging from 1-9, inclusive.
+ *      max_learned: The number of learned clauses to keep before forgetting them all, 0 for as
+ *          many as the clause arena holds.
+ *      num_conflicts: [Optional Out] The number of conflicts the solver hit.
+ *
+ *  Returns:
+ *      ENOERR on success, ENODATA if the board has no solution, EINVAL for bad input.
+ */
+int solve_sat(char board[81], int max_learned, int *num_conflicts);
+
+#endif  /* __SUDO_SAT__ */
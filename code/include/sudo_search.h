@@ -0,0 +1,92 @@
+/*
+ *  This library defines the depth-first search fallback on behalf of SUDO.
+ */
+
+#ifndef __SUDO_SEARCH__
+#define __SUDO_SEARCH__
+
+#include <stdint.h>                         // uint64_t
+#include "sudo_state.h"                     // sudo_state_t
+#include "sudo_ttable.h"                    // sudo_ttable_t
+
+/* SEARCH MACROS */
+// SUDO_RESTART_BASE
+#define SUDO_RESTART_BASE 64  // Default nodes per unit of the restart schedule
+
+/*
+ *  Restart schedules for solve_search_restarts().  Each run may visit (base * the schedule's
+ *  next term) nodes before the search gives up on it and starts over with a fresh ordering.
+ */
+typedef enum
+{
+    SUDO_RESTART_NONE = 0,       // One deterministic run, low digits first
+    SUDO_RESTART_LUBY = 1,       // Randomized runs sized by the Luby sequence: 1, 1, 2, 1, 1, 2, 4
+    SUDO_RESTART_GEOMETRIC = 2,  // Randomized runs that double in size: 1, 2, 4, 8
+} sudo_restart_t;
+
+/*
+ *  Description:
+ *      Count the board's solutions by depth-first search, stopping as soon as limit are found.
+ *      Nodes propagate singles and branch on minimum remaining values exactly as solve_search()
+ *      does, so proving a board unique (limit 2) costs about as much as solving it and then
+ *      refuting the rest of the tree.
+ *
+ *  Args:
+ *      state: The solver state.  Left untouched.
+ *      limit: Stop after this many solutions, at least 1.
+ *      num_solutions: [Out] The number of solutions found, 0 to limit.
+ *      witnesses: [Optional Out] Room for limit game boards.  The i-th solution found is
+ *          written to witnesses[i].
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int count_search(sudo_state_t *state, int limit, int *num_solutions, char witnesses[][81]);
+
+/*
+ *  Description:
+ *      Solve the board by depth-first search once the logical strategies stall.  Each node
+ *      propagates naked and hidden singles, then branches on the empty cell with the fewest
+ *      candidates (minimum remaining values).  Branches modify the state in place and a
+ *      fixed-capacity undo trail on the stack rolls back the ones that fail, so no memory is
+ *      allocated and no state is copied.
+ *
+ *  Args:
+ *      state: [In/Out] The solver state.  Holds the first solution found on success and is left
+ *          untouched otherwise.
+ *      num_nodes: [Optional Out] The number of search nodes visited, capped at INT_MAX.
+ *
+ *  Returns:
+ *      ENOERR if a solution was found, ENODATA if there is none, EINVAL for bad input.
+ */
+int solve_search(sudo_state_t *state, int *num_nodes);
+
+/*
+ *  Description:
+ *      solve_search() with randomized restarts.  Deterministic ordering has a heavy tail: a bad
+ *      early branch can cost orders of magnitude more nodes than the median board.  Each run
+ *      breaks minimum remaining values ties at random and tries the branch cell's candidates in a
+ *      random order, and is abandoned (and undone) once it exceeds its node limit.  Run limits
+ *      grow without bound, so the search is still complete.  The random stream is fully
+ *      determined by seed, so any run can be reproduced.
+ *
+ *      If a transposition table is given, every refuted subtree is recorded in it and skipped
+ *      wherever it turns up again: in a later run that reaches the same placements by another
+ *      order, or in a later solve that shares the table.
+ *
+ *  Args:
+ *      state: [In/Out] The solver state.  Holds the first solution found on success and is left
+ *          untouched otherwise.
+ *      restart: The restart schedule.  SUDO_RESTART_NONE is solve_search().
+ *      base: Nodes per unit of the restart schedule, at least 1.
+ *      seed: Seeds the random ordering.  Any value, including 0, is a valid seed.
+ *      table: [Optional In/Out] Refuted subtrees to skip and add to.  NULL disables.
+ *      num_nodes: [Optional Out] The number of search nodes visited over every run.
+ *
+ *  Returns:
+ *      ENOERR if a solution was found, ENODATA if there is none, EINVAL for bad input.
+ */
+int solve_search_restarts(sudo_state_t *state, sudo_restart_t restart, int base, uint64_t seed,
+                          sudo_ttable_t *table, uint64_t *num_nodes);
+
+#endif  /* __SUDO_SEARCH__ */
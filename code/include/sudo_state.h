@@ -0,0 +1,340 @@
+/*
+ *  This library defines the bitmask solver state used by SUDO's game logic.
+ *
+ *  Candidates and placed digits are tracked as 9-bit masks: bit (digit - 1) represents digit.
+ */
+
+#ifndef __SUDO_STATE__
+#define __SUDO_STATE__
+
+#include <stdbool.h>                        // bool
+#include <stdint.h>                         // uint8_t, uint16_t, uint32_t, uint64_t
+#include "sudo_cellset.h"                   // sudo_cellset_t
+
+/* STATE MACROS */
+// SUDO_ALL_CANDS
+#define SUDO_ALL_CANDS ((uint16_t)0x01FF)  // Every digit is a candidate
+// SUDO_DIGIT_BIT
+#define SUDO_DIGIT_BIT(digit) ((uint16_t)(1 << ((digit) - 1)))  // Mask bit for a digit 1-9
+// SUDO_NUM_PEERS
+#define SUDO_NUM_PEERS 20  // Number of cells sharing a row, col, or grid with any given cell
+// SUDO_NUM_UNITS
+#define SUDO_NUM_UNITS 27  // Rows, then columns, then 3x3 grids
+// SUDO_CELL_ROW, SUDO_CELL_COL, SUDO_CELL_BOX
+#define SUDO_CELL_ROW(cell) ((cell) / 9)                                // Row index 0-8
+#define SUDO_CELL_COL(cell) ((cell) % 9)                                // Column index 0-8
+#define SUDO_CELL_BOX(cell) ((((cell) / 27) * 3) + (((cell) % 9) / 3))  // Grid index 0-8
+// SUDO_ROW_UNIT, SUDO_COL_UNIT, SUDO_BOX_UNIT
+#define SUDO_ROW_UNIT(row) (row)         // Unit index of a row
+#define SUDO_COL_UNIT(col) (9 + (col))   // Unit index of a column
+#define SUDO_BOX_UNIT(box) (18 + (box))  // Unit index of a 3x3 grid
+// SUDO_TRAIL_LEN
+#define SUDO_TRAIL_LEN 4096  // Undo entries: a path can change at most 3564 masks and cells
+// SUDO_TRAIL_DEPTH
+#define SUDO_TRAIL_DEPTH 82  // Undo levels: one per placement plus one for the root
+
+typedef struct sudo_trail sudo_trail_t;  // Undo log, defined below
+
+/*
+ *  Solver state for a single game board.  The struct is fixed-size and self-contained so it
+ *  may be copied by assignment.
+ *
+ *  Each unit also keeps, per digit, a 9-bit mask of the slots (see sudo_unit_cells) where that
+ *  digit can still go.  These are updated alongside the candidate masks so a hidden single is a
+ *  mask lookup instead of a unit rescan.
+ *
+ *  A digit with exactly two slots left in a unit forms a strong link (a conjugate pair): one of
+ *  the two cells must hold it.  Each digit keeps a 27-bit mask of the units where that is true,
+ *  updated alongside the slot masks, so the strong-link graph never has to be rebuilt.
+ *
+ *  Empty cells whose candidate mask drops to a single digit, and unit/digit pairs whose slot mask
+ *  drops to a single slot, are queued as they are discovered so propagation only ever revisits
+ *  the peers of a placement.  Masks only shrink, so each cell (81) and unit/digit pair (243) can
+ *  be queued at most once.
+ *
+ *  The hash is a Zobrist hash of the placed digits: the XOR of sudo_zobrist[cell][digit - 1]
+ *  over every filled cell, updated with one XOR per placement.  Two states reached from the same
+ *  board by placing the same digits in a different order hash the same.
+ */
+typedef struct
+{
+    uint8_t cells[81];           // Placed digits: 0 for an empty cell, 1-9 otherwise
+    uint16_t cands[81];          // Candidate mask for each empty cell (0 for placed cells)
+    uint16_t unit_used[27];      // Digits placed in each unit
+    uint16_t unit_pos[27][9];    // Slot mask for each unit and digit index (digit - 1)
+    uint32_t strong_units[9];    // Units where each digit index has exactly two slots left
+    int num_empty;               // Number of empty cells left on the board
+    uint64_t hash;               // Zobrist hash of the placed digits
+    bool contradiction;          // A cell ran out of candidates or a digit ran out of slots
+    uint8_t single_queue[81];    // Cells discovered with exactly one candidate
+    int single_head;             // Index of the next cell to pop from single_queue
+    int single_tail;             // Index of the next free slot in single_queue
+    uint8_t hidden_queue[243];   // (unit * 9) + (digit - 1) pairs discovered with one slot left
+    int hidden_head;             // Index of the next pair to pop from hidden_queue
+    int hidden_tail;             // Index of the next free slot in hidden_queue
+    sudo_trail_t *trail;         // Undo log recording changes to this state, or NULL
+} sudo_state_t;
+
+/*
+ *  One undone write: a candidate mask, placed digit, or unit mask and its old value.
+ */
+typedef struct
+{
+    uint16_t index;  // Which mask or cell was written (private to sudo_state.c)
+    uint16_t value;  // Its value before the write
+} sudo_trail_entry_t;
+
+/*
+ *  The scalars and strong link masks of a state when an undo level was opened.  These are cheaper
+ *  to snapshot whole than to log per write.  The queues only ever append, so restoring their head
+ *  and tail restores their contents.
+ */
+typedef struct
+{
+    int trail_len;               // Number of trail entries when the level was opened
+    int num_empty;               // Saved num_empty
+    uint64_t hash;               // Saved hash
+    bool contradiction;          // Saved contradiction
+    int single_head;             // Saved single_head
+    int single_tail;             // Saved single_tail
+    int hidden_head;             // Saved hidden_head
+    int hidden_tail;             // Saved hidden_tail
+    uint32_t strong_units[9];    // Saved strong_units
+} sudo_trail_frame_t;
+
+/*
+ *  Fixed-capacity undo log for a single solver state.  Once a level is opened every write to the
+ *  state's masks and cells logs the old value, so backtracking replays the (short) log instead of
+ *  copying the whole state.  Masks only shrink along one path, which bounds the log at 3564
+ *  entries: 729 candidate removals, 2187 cleared slot bits, and 81 placements that each write a
+ *  cell, its candidate mask, and three unit_used and three slot masks.
+ */
+struct sudo_trail
+{
+    const sudo_state_t *owner;                      // The state being recorded
+    sudo_trail_entry_t entries[SUDO_TRAIL_LEN];     // Old values, oldest first
+    int len;                                        // Number of entries in use
+    sudo_trail_frame_t frames[SUDO_TRAIL_DEPTH];    // Snapshot for each open level
+    int depth;                                      // Number of open levels
+};
+
+/*
+ *  Lookup tables populated by init_sudo_state() or init_sudo_tables().
+ */
+extern uint8_t sudo_peers[81][SUDO_NUM_PEERS];  // The 20 peers of each cell
+extern sudo_cellset_t sudo_peer_sets[81];       // The 20 peers of each cell, as a cell set
+extern sudo_cellset_t sudo_unit_sets[27];       // The cells of each unit, as a cell set
+extern uint8_t sudo_unit_cells[27][9];          // The cells of each unit, in slot order
+extern uint8_t sudo_cell_units[81][3];          // The row, col, and grid unit of each cell
+extern uint8_t sudo_cell_slots[81][3];          // The slot of each cell within those units
+extern uint64_t sudo_zobrist[81][9];            // Random key for each cell and digit index
+
+/*
+ *  Description:
+ *      Copy the state's placed digits into a game board.
+ *
+ *  Args:
+ *      state: The solver state to export.
+ *      board: [Out] A fixed-size array of 81 characters.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int export_sudo_state(const sudo_state_t *state, char board[81]);
+
+/*
+ *  Description:
+ *      Initialize a solver state from a game board.  Candidate masks are computed for every
+ *      empty cell.  This function does not validate the board's characters.
+ *
+ *  Args:
+ *      state: [Out] The solver state to initialize.
+ *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
+ *          or number ranging from 1-9, inclusive.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or a board with duplicate entries.
+ */
+int init_sudo_state(sudo_state_t *state, const char board[81]);
+
+/*
+ *  Description:
+ *      Populate the lookup tables on first use.  init_sudo_state() calls this, so only code
+ *      that uses the tables without a solver state needs to.  Safe to call from several threads
+ *      at once: the first one populates the tables and the rest wait for it.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      None
+ */
+void init_sudo_tables(void);
+
+/*
+ *  Description:
+ *      Pop the next hidden single: a digit with exactly one slot left in some unit.  Pairs whose
+ *      digit was placed in the unit since they were queued are skipped.
+ *
+ *  Args:
+ *      state: The solver state to pop from.
+ *      digit: [Out] The digit that belongs in the returned cell.
+ *
+ *  Returns:
+ *      A cell index 0-80 on success, -1 if the queue is empty or state is NULL.
+ */
+int next_sudo_hidden(sudo_state_t *state, int *digit);
+
+/*
+ *  Description:
+ *      Pop the next cell from the queue of cells discovered with exactly one candidate.  Cells
+ *      that were filled in since they were queued are skipped.
+ *
+ *  Args:
+ *      state: The solver state to pop from.
+ *
+ *  Returns:
+ *      A cell index 0-80 on success, -1 if the queue is empty or state is NULL.
+ */
+int next_sudo_single(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Make every queued naked and hidden single play, and every play those expose, until the
+ *      queues run dry (a fixed point), the board is full, a contradiction is found, or budget
+ *      plays have been made.  Each play is assign_sudo_digit() inlined, and the loop is built for
+ *      each ISA SUDO_DISPATCH supports.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      budget: The most plays to make.
+ *      num_plays: [Optional Out] The number of plays made.
+ *
+ *  Returns:
+ *      ENOERR if propagation stopped on its own (check the state's contradiction flag), ENODATA
+ *      if it ran out of budget, EINVAL for bad input.
+ */
+int propagate_sudo_singles(sudo_state_t *state, int budget, int *num_plays);
+
+/*
+ *  Description:
+ *      Undo every change to the state since the most recent push_sudo_trail() and close that
+ *      level.
+ *
+ *  Args:
+ *      state: The solver state to restore.
+ *
+ *  Returns:
+ *      ENOERR on success, ENODATA if no level is open, EINVAL for bad input or a state without
+ *      a trail.
+ */
+int pop_sudo_trail(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Open an undo level: changes made to the state from now on can be undone by
+ *      pop_sudo_trail().
+ *
+ *  Args:
+ *      state: The solver state to record.
+ *
+ *  Returns:
+ *      ENOERR on success, EOVERFLOW if SUDO_TRAIL_DEPTH levels are already open, EINVAL for bad
+ *      input or a state without a trail.
+ */
+int push_sudo_trail(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Place digit in cell and remove it from the candidate masks of the cell's peers.  Only the
+ *      20 peers are revisited: any peer left with one candidate is queued and any peer left with
+ *      none sets the state's contradiction flag.  Unit slot masks are updated the same way.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The cell index, 0-80.
+ *      digit: The digit to place, 1-9.  Must be a candidate for cell.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input or a digit that is not a candidate.
+ */
+int place_sudo_digit(sudo_state_t *state, int cell, int digit);
+
+/*
+ *  Description:
+ *      place_sudo_digit() without the input validation, for the solver's inner loops: an
+ *      out-of-line, per-ISA (SUDO_DISPATCH) copy of sudo_kernel.h's assign_sudo_digit().  Debug
+ *      builds assert the preconditions instead.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The index of an empty cell, 0-80.
+ *      digit: The digit to place, 1-9.  Must be a candidate for cell.
+ *
+ *  Returns:
+ *      None
+ */
+void play_sudo_digit(sudo_state_t *state, int cell, int digit);
+
+/*
+ *  Description:
+ *      Remove digit from cell's candidate mask and from the slot masks of the cell's units.  A
+ *      cell (or unit) left with one option is queued and one left with none sets the state's
+ *      contradiction flag.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cell: The cell index, 0-80.
+ *      digit: The candidate to remove, 1-9.
+ *
+ *  Returns:
+ *      ENOERR if the candidate was removed, ENODATA if it was not a candidate, EINVAL for bad
+ *      input.
+ */
+int remove_sudo_candidate(sudo_state_t *state, int cell, int digit);
+
+/*
+ *  Description:
+ *      Remove digit from the candidate masks of every cell in a cell set.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      cells: The cells to update.
+ *      digit: The candidate to remove, 1-9.
+ *
+ *  Returns:
+ *      The number of candidates removed.  Bad input removes nothing.
+ */
+int remove_sudo_cells(sudo_state_t *state, sudo_cellset_t cells, int digit);
+
+/*
+ *  Description:
+ *      Remove digit from the candidate masks of every cell in the given slots of unit.
+ *
+ *  Args:
+ *      state: The solver state to update.
+ *      unit: The unit index, 0-26.
+ *      slots: Slot mask, within unit, of the cells to update.
+ *      digit: The candidate to remove, 1-9.
+ *
+ *  Returns:
+ *      The number of candidates removed.  Bad input removes nothing.
+ */
+int remove_sudo_slots(sudo_state_t *state, int unit, uint16_t slots, int digit);
+
+/*
+ *  Description:
+ *      Start (or stop) recording changes to a state.  Only the state passed here is recorded:
+ *      struct copies of it share the trail pointer but never write to the trail.
+ *
+ *  Args:
+ *      state: The solver state to record.
+ *      trail: [Optional] The undo log to use, emptied first.  NULL stops recording and keeps
+ *          every change made so far.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int start_sudo_trail(sudo_state_t *state, sudo_trail_t *trail);
+
+#endif  /* __SUDO_STATE__ */
@@ -0,0 +1,37 @@
+/*
+ *  This library defines the naked and hidden subset (pair, triple, quad) strategy for SUDO.
+ */
+
+#ifndef __SUDO_SUBSETS__
+#define __SUDO_SUBSETS__
+
+#include <stdint.h>                         // uint16_t
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_MAX_SUBSET
+#define SUDO_MAX_SUBSET 4  // Largest subset (quad) to look for
+
+/*
+ *  Precomputed combination tables: sudo_combos[size] holds every 9-bit mask with exactly size bits
+ *  set, for size 2 through SUDO_MAX_SUBSET, and sudo_num_combos[size] holds its length.
+ */
+extern const uint16_t *sudo_combos[SUDO_MAX_SUBSET + 1];
+extern const int sudo_num_combos[SUDO_MAX_SUBSET + 1];
+
+/*
+ *  Description:
+ *      Make naked and hidden subset eliminations in all 27 units.  Pairs are tried first, then
+ *      triples, then quads, stopping after the first size that makes progress.  This function
+ *      does not validate the solver state.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_subsets(sudo_state_t *state, int *num_elims);
+
+#endif  /* __SUDO_SUBSETS__ */
@@ -0,0 +1,40 @@
+/*
+ *  This library defines the template (pattern overlay) engine on behalf of SUDO.
+ *
+ *  A template is one legal placement of a single digit on an empty board: one cell in every row,
+ *  col, and 3x3 grid.  There are 46,656 of them and every digit of a solution fills one.
+ */
+
+#ifndef __SUDO_TEMPLATE__
+#define __SUDO_TEMPLATE__
+
+#include "sudo_cellset.h"                   // sudo_cellset_t
+#include "sudo_state.h"                     // sudo_state_t
+
+// SUDO_NUM_TEMPLATES
+#define SUDO_NUM_TEMPLATES 46656  // (9 * 6 * 3) * (6 * 4 * 2) * (3 * 2 * 1)
+
+/*
+ *  Every template as a cell set, populated by solve_templates() on first use.
+ */
+extern sudo_cellset_t sudo_templates[SUDO_NUM_TEMPLATES];
+
+/*
+ *  Description:
+ *      Make template eliminations.  For each digit, filter the templates down to the ones that
+ *      cover every cell the digit is placed in and only cells where it is placed or a candidate.
+ *      The digit is removed from every cell no surviving template covers, and a cell that every
+ *      surviving template covers loses its other candidates.  This function does not validate
+ *      the solver state.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.  A digit with no surviving templates sets the state's contradiction flag.
+ */
+int solve_templates(sudo_state_t *state, int *num_elims);
+
+#endif  /* __SUDO_TEMPLATE__ */
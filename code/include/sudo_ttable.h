@@ -0,0 +1,103 @@
+/*
+ *  This library defines a transposition table on behalf of SUDO's search.
+ *
+ *  The table is a cache of refuted subtrees: the Zobrist hash of every search state the search
+ *  proved has no solution.  It is bounded: a power of two of slots, one per hash bucket, and
+ *  every store replaces whatever was there.
+ *
+ *  A hash covers the placed digits, givens included, and the strategies only make eliminations
+ *  the givens imply, so a refutation holds for any board that reaches the same placements.  One
+ *  table may therefore be shared by many solves (see sudo_options_t.ttable), including solves
+ *  running on different threads at once.  The exception is assume_unique: its eliminations only
+ *  hold for boards with exactly one solution, so don't share a table with a solve that lies.
+ *
+ *  Each slot is a single 64-bit word holding the whole hash, read and written with relaxed
+ *  atomics and no locks.  A probe can never see half of a store, and a bucket collision reads as
+ *  a miss instead of a wrong result.
+ */
+
+#ifndef __SUDO_TTABLE__
+#define __SUDO_TTABLE__
+
+#include <stdatomic.h>                      // _Atomic
+#include <stdbool.h>                        // bool
+#include <stddef.h>                         // size_t
+#include <stdint.h>                         // uint64_t
+
+// SUDO_TTABLE_LEN
+#define SUDO_TTABLE_LEN ((size_t)1 << 16)  // Default number of slots: 512 KiB
+
+/*
+ *  A transposition table.  Use create_sudo_ttable() and destroy_sudo_ttable().
+ */
+typedef struct
+{
+    _Atomic uint64_t *slots;  // Heap-allocated slots: a refuted hash, or 0 while empty
+    size_t mask;              // Number of slots - 1
+} sudo_ttable_t;
+
+/*
+ *  Description:
+ *      Empty every slot.  Not safe to call while a solve is using the table.
+ *
+ *  Args:
+ *      table: The table to clear.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int clear_sudo_ttable(sudo_ttable_t *table);
+
+/*
+ *  Description:
+ *      Allocate an empty table.
+ *
+ *  Args:
+ *      table: [Out] The table to create.
+ *      num_slots: The number of slots, rounded up to a power of two.  At least 1.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input, or errno from the allocation.
+ */
+int create_sudo_ttable(sudo_ttable_t *table, size_t num_slots);
+
+/*
+ *  Description:
+ *      Free a table's slots.
+ *
+ *  Args:
+ *      table: The table to destroy.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int destroy_sudo_ttable(sudo_ttable_t *table);
+
+/*
+ *  Description:
+ *      Has a state been refuted?
+ *
+ *  Args:
+ *      table: The table.
+ *      hash: A state's Zobrist hash.
+ *
+ *  Returns:
+ *      True on a hit, false on a miss or bad input.
+ */
+bool probe_sudo_ttable(const sudo_ttable_t *table, uint64_t hash);
+
+/*
+ *  Description:
+ *      Record a refuted state, replacing whatever shared its slot.  Hash 0 (no placements at
+ *      all) is never recorded: the empty board always has a solution.
+ *
+ *  Args:
+ *      table: The table.
+ *      hash: The refuted state's Zobrist hash.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int store_sudo_ttable(sudo_ttable_t *table, uint64_t hash);
+
+#endif  /* __SUDO_TTABLE__ */
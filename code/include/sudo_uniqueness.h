@@ -0,0 +1,43 @@
+/*
+ *  This library defines the uniqueness (Unique Rectangle, BUG+1) strategies on behalf of SUDO.
+ *
+ *  These strategies are only sound for boards with exactly one solution.  They eliminate
+ *  candidates that would otherwise leave a "deadly pattern": a set of cells whose digits could be
+ *  swapped to make a second solution.
+ */
+
+#ifndef __SUDO_UNIQUENESS__
+#define __SUDO_UNIQUENESS__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+/*
+ *  Description:
+ *      Make uniqueness eliminations.  Unique Rectangles are tried first, then BUG+1.  This
+ *      function does not validate the solver state and must only be used on a board known to
+ *      have a unique solution.
+ *
+ *  Notes:
+ *      UNIQUE RECTANGLE: Four empty cells in two rows, two cols, and two 3x3 grids that all hold
+ *          candidates {a,b} can't be reduced to just {a,b} (the a's and b's could be swapped).
+ *          TYPE 1: Three corners are exactly {a,b}, so a and b can't go in the fourth.
+ *          TYPE 2: The other two corners are both {a,b,c}, so one is c: c can't go in any cell
+ *              that sees both.
+ *          TYPE 3: The other two corners' extra candidates act as one cell that can form a naked
+ *              subset with other cells in a unit they share.
+ *          TYPE 4: The other two corners share a unit where a only goes in those two cells, so b
+ *              can't go in either one.
+ *      BUG+1: If every empty cell is bivalue but one, which has three candidates, that cell must
+ *          hold the candidate that appears three times in its units.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_uniqueness(sudo_state_t *state, int *num_elims);
+
+#endif  /* __SUDO_UNIQUENESS__ */
@@ -0,0 +1,35 @@
+/*
+ *  This library defines the wing (XY-Wing, XYZ-Wing, W-Wing) strategies on behalf of SUDO.
+ */
+
+#ifndef __SUDO_WINGS__
+#define __SUDO_WINGS__
+
+#include "sudo_state.h"                     // sudo_state_t
+
+/*
+ *  Description:
+ *      Make wing eliminations.  XY-Wings are tried first, then XYZ-Wings, then W-Wings, stopping
+ *      after the first type that makes progress.  This function does not validate the solver
+ *      state.
+ *
+ *  Notes:
+ *      XY-WING: A pivot {a,b} sees pincers {a,z} and {b,z}.  Either pincer must be z, so z can't
+ *          go in any cell that sees both pincers.
+ *      XYZ-WING: A pivot {a,b,z} sees pincers {a,z} and {b,z}.  One of the three must be z, so z
+ *          can't go in any cell that sees all three.
+ *      W-WING: Two cells {a,b} that don't see each other are joined by a strong link on a (a
+ *          unit where a has exactly two slots, one seen by each cell).  One of them must be b, so
+ *          b can't go in any cell that sees both.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      num_elims: [Optional Out] The number of candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if at least one candidate was eliminated, ENODATA if none were, EINVAL for bad
+ *      input.
+ */
+int solve_wings(sudo_state_t *state, int *num_elims);
+
+#endif  /* __SUDO_WINGS__ */
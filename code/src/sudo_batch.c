@@ -0,0 +1,331 @@
+/*
+ *  This library defines a multi-board lane solver on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdbool.h>                        // bool, false, true
+#include <stddef.h>                         // size_t
+#include <stdint.h>                         // int16_t, uint16_t
+#include "sudo_batch.h"                     // solve_batch()
+#include "sudo_bitboard.h"                  // solve_bitboard()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_CTZ(), SUDO_DISPATCH
+#include "sudo_state.h"                     // init_sudo_tables(), sudo_peers, sudo_unit_cells
+#include "sudo_validation.h"                // validate_board()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/* BATCH MACROS */
+// SUDO_BATCH_IDLE
+#define SUDO_BATCH_IDLE -1  // Board index of a lane with no board loaded
+
+/*
+ *  One 9-bit candidate mask per lane, and the matching lane-wise truth values (0 or -1).
+ */
+typedef uint16_t sudo_lanes_t __attribute__((vector_size(SUDO_BATCH_LANES * sizeof(uint16_t))));
+typedef int16_t sudo_lane_mask_t
+    __attribute__((vector_size(SUDO_BATCH_LANES * sizeof(int16_t))));
+
+/*
+ *  The lanes, in struct-of-arrays layout.
+ */
+typedef struct
+{
+    sudo_lanes_t cands[81];               // Candidate mask for each cell (one bit once solved)
+    int board_index[SUDO_BATCH_LANES];    // Board loaded in each lane, or SUDO_BATCH_IDLE
+} sudo_batch_t;
+
+/*
+ *  What one sweep found, lane-wise.
+ */
+typedef struct
+{
+    sudo_lanes_t changed;   // Nonzero where a mask changed
+    sudo_lane_mask_t dead;  // A contradiction was found
+} sudo_sweep_t;
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Load the next valid board into a lane, skipping (and reporting) invalid ones.
+ *
+ *  Args:
+ *      batch: The lanes.
+ *      lane: The lane to load, 0 to SUDO_BATCH_LANES - 1.
+ *      boards: The input boards.
+ *      num_boards: The number of input boards.
+ *      next: [In/Out] Index of the next board to load.
+ *      num_invalid: [In/Out] Incremented for every invalid board skipped.
+ *      results: [Optional Out] Per-board results.
+ *
+ *  Returns:
+ *      True if a board was loaded, false if the input ran out (the lane is left idle).
+ */
+bool load_batch_lane(sudo_batch_t *batch, int lane, char *boards[], int num_boards, int *next,
+                     int *num_invalid, int results[]);
+
+/*
+ *  Description:
+ *      Finish the board in a lane: write out a solution, hand a stalled board to the scalar
+ *      solver, or report a contradiction.
+ *
+ *  Args:
+ *      batch: The lanes.
+ *      lane: The lane to retire.
+ *      dead: Did the lane find a contradiction?
+ *      board: [Out] The lane's board.
+ *
+ *  Returns:
+ *      ENOERR if the board was solved, ENODATA if it has no solution.
+ */
+int retire_batch_lane(const sudo_batch_t *batch, int lane, bool dead, char board[81]);
+
+/*
+ *  Description:
+ *      Make one pass of naked and hidden single eliminations over every lane.  Built for each
+ *      ISA SUDO_DISPATCH supports.
+ *
+ *  Args:
+ *      batch: The lanes to update.
+ *      sweep: [Out] What the pass found.  Passed by pointer since the ISA-specific copies don't
+ *          agree on how to pass vectors by value.
+ *
+ *  Returns:
+ *      None
+ */
+void sweep_batch(sudo_batch_t *batch, sudo_sweep_t *sweep);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_batch(char *boards[], int num_boards, int results[])
+{
+    // LOCAL VARIABLES
+    int results_all = ENOERR;  // Results of execution
+    sudo_batch_t batch;        // The lanes
+    sudo_sweep_t sweep;        // What the last sweep found
+    int next = 0;              // Index of the next board to load
+    int num_active = 0;        // Number of lanes with a board loaded
+    int num_invalid = 0;       // Number of invalid boards skipped
+    int index = 0;             // Board index of a lane
+    int board_results = 0;     // Results for one board
+
+    // INPUT VALIDATION
+    if (NULL == boards || num_boards < 0)
+    {
+        results_all = EINVAL;  // Bad input
+        goto done;
+    }
+
+    // FILL THE LANES
+    init_sudo_tables();
+    for (int lane = 0; lane < SUDO_BATCH_LANES; lane++)
+    {
+        if (true == load_batch_lane(&batch, lane, boards, num_boards, &next, &num_invalid,
+                                    results))
+        {
+            num_active++;
+        }
+    }
+
+    // SOLVE THEM
+    while (num_active > 0)
+    {
+        sweep_batch(&batch, &sweep);
+        for (int lane = 0; lane < SUDO_BATCH_LANES; lane++)
+        {
+            index = batch.board_index[lane];
+            if (SUDO_BATCH_IDLE == index || (0 != sweep.changed[lane] && 0 == sweep.dead[lane]))
+            {
+                continue;  // Idle or still making progress
+            }
+            // Solved, stalled, or dead: retire it and refill the lane
+            board_results = retire_batch_lane(&batch, lane, 0 != sweep.dead[lane],
+                                              boards[index]);
+            if (ENOERR != board_results)
+            {
+                results_all = ENODATA;
+            }
+            if (NULL != results)
+            {
+                results[index] = board_results;
+            }
+            num_active--;
+            if (true == load_batch_lane(&batch, lane, boards, num_boards, &next, &num_invalid,
+                                        results))
+            {
+                num_active++;
+            }
+        }
+    }
+    if (num_invalid > 0)
+    {
+        results_all = ENODATA;  // Skipped at least one board
+    }
+
+    // DONE
+done:
+    return results_all;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+bool load_batch_lane(sudo_batch_t *batch, int lane, char *boards[], int num_boards, int *next,
+                     int *num_invalid, int results[])
+{
+    // LOCAL VARIABLES
+    bool loaded = false;  // Was a board loaded?
+    char *board = NULL;   // Board to load
+
+    // LOAD IT
+    batch->board_index[lane] = SUDO_BATCH_IDLE;
+    while (false == loaded && *next < num_boards)
+    {
+        board = boards[*next];
+        if (NULL == board || ENOERR != validate_board(board))
+        {
+            FPRINTF_ERR("%s Skipping invalid board %d\n", DEBUG_WARNG_STR, *next);
+            (*num_invalid)++;
+            if (NULL != results)
+            {
+                results[*next] = EINVAL;
+            }
+        }
+        else
+        {
+            for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+            {
+                batch->cands[cell][lane] = (SUDO_EMPTY_GRID == board[cell])
+                                           ? 0x1FF : 1 << (board[cell] - '1');
+            }
+            batch->board_index[lane] = *next;
+            loaded = true;
+        }
+        (*next)++;
+    }
+    if (false == loaded)
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            batch->cands[cell][lane] = 0x1FF;  // Idle lanes never stall the others
+        }
+    }
+
+    // DONE
+    return loaded;
+}
+
+
+int retire_batch_lane(const sudo_batch_t *batch, int lane, bool dead, char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    uint16_t cands = 0;    // Candidate mask of a cell
+    bool solved = true;    // Is every cell down to one candidate?
+
+    // EXPORT IT
+    if (true == dead)
+    {
+        results = ENODATA;  // No solution
+    }
+    else
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            cands = batch->cands[cell][lane];
+            if (0 == (cands & (cands - 1)))
+            {
+                board[cell] = '1' + SUDO_CTZ(cands);
+            }
+            else
+            {
+                board[cell] = SUDO_EMPTY_GRID;
+                solved = false;
+            }
+        }
+        if (false == solved)
+        {
+            results = solve_bitboard(board, NULL);  // Stalled: finish it with search
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+SUDO_DISPATCH void sweep_batch(sudo_batch_t *batch, sudo_sweep_t *sweep)
+{
+    // LOCAL VARIABLES
+    sudo_lanes_t cands;             // Candidate masks of a cell
+    sudo_lanes_t before;            // Candidate masks before an update
+    sudo_lanes_t elim;              // Solved digit to remove from the peers, per lane
+    sudo_lane_mask_t single;        // Lanes where the cell has exactly one candidate
+    sudo_lane_mask_t update;        // Lanes where a cell holds a hidden single
+    sudo_lanes_t ones;              // Digits seen at least once in a unit
+    sudo_lanes_t twos;              // Digits seen at least twice in a unit
+    sudo_lanes_t hidden;            // Digits seen exactly once in a unit
+    sudo_lanes_t found;             // Hidden single digits in a cell
+
+    // NAKED SINGLES
+    sweep->changed = (sudo_lanes_t){ 0 };
+    sweep->dead = (sudo_lane_mask_t){ 0 };
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        cands = batch->cands[cell];
+        sweep->dead |= (sudo_lane_mask_t)(cands == 0);
+        single = (sudo_lane_mask_t)((cands & (cands - 1)) == 0);
+        elim = cands & (sudo_lanes_t)single;
+        for (int i = 0; i < SUDO_NUM_PEERS; i++)
+        {
+            before = batch->cands[sudo_peers[cell][i]];
+            batch->cands[sudo_peers[cell][i]] = before & ~elim;
+            sweep->changed |= before & elim;
+        }
+    }
+
+    // HIDDEN SINGLES
+    for (int unit = 0; unit < SUDO_NUM_UNITS; unit++)
+    {
+        ones = (sudo_lanes_t){ 0 };
+        twos = (sudo_lanes_t){ 0 };
+        for (int slot = 0; slot < 9; slot++)
+        {
+            cands = batch->cands[sudo_unit_cells[unit][slot]];
+            twos |= ones & cands;
+            ones |= cands;
+        }
+        sweep->dead |= (sudo_lane_mask_t)(ones != 0x1FF);  // A digit has nowhere to go
+        hidden = ones & ~twos;
+        for (int slot = 0; slot < 9; slot++)
+        {
+            cands = batch->cands[sudo_unit_cells[unit][slot]];
+            found = cands & hidden;
+            update = (sudo_lane_mask_t)(found != 0)
+                     & (sudo_lane_mask_t)((cands & (cands - 1)) != 0);
+            // Two digits that both have to go in one cell
+            sweep->dead |= update & (sudo_lane_mask_t)((found & (found - 1)) != 0);
+            batch->cands[sudo_unit_cells[unit][slot]] = (found & (sudo_lanes_t)update)
+                                                        | (cands & ~(sudo_lanes_t)update);
+            sweep->changed |= cands & ~found & (sudo_lanes_t)update;
+        }
+    }
+
+    // DONE
+    return;
+}
@@ -0,0 +1,367 @@
+/*
+ *  This library defines a bitboard representation and solver on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdbool.h>                        // bool, false, true
+#include <string.h>                         // memset()
+#include "sudo_bitboard.h"                  // sudo_bitboard_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_DISPATCH, SUDO_EMPTY_GRID
+#include "sudo_state.h"                     // init_sudo_tables(), sudo_peer_sets, sudo_unit_sets
+#include "sudo_validation.h"                // validate_board()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/* BITBOARD MACROS */
+// SUDO_BITBOARD_ALL
+#define SUDO_BITBOARD_ALL ((sudo_cellset_t){ { ~0ULL, (1ULL << 17) - 1 } })  // Cells 0-80
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Find the unsolved cell with the fewest candidates.
+ *
+ *  Args:
+ *      bitboard: The bitboard.
+ *
+ *  Returns:
+ *      A cell index 0-80, or -1 if every cell is solved.
+ */
+int pick_bitboard_cell(const sudo_bitboard_t *bitboard);
+
+/*
+ *  Description:
+ *      Propagate singles and then try every candidate of the most constrained cell.
+ *
+ *  Args:
+ *      bitboard: [In/Out] The bitboard.  Holds the solution on success.
+ *      num_nodes: [In/Out] Incremented for every node visited.
+ *
+ *  Returns:
+ *      ENOERR if a solution was found, ENODATA if there is none.
+ */
+int search_bitboard(sudo_bitboard_t *bitboard, int *num_nodes);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int export_sudo_bitboard(const sudo_bitboard_t *bitboard, char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == bitboard || NULL == board)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // EXPORT IT
+    if (ENOERR == results)
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            board[cell] = SUDO_EMPTY_GRID;
+            if (false == SUDO_CELLSET_HAS(bitboard->unsolved, cell))
+            {
+                for (int digit = 1; digit <= 9; digit++)
+                {
+                    if (SUDO_CELLSET_HAS(bitboard->digits[digit - 1], cell))
+                    {
+                        board[cell] = '0' + digit;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+int init_sudo_bitboard(sudo_bitboard_t *bitboard, const char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == bitboard || NULL == board)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // SETUP
+    if (ENOERR == results)
+    {
+        init_sudo_tables();
+        for (int digit = 0; digit < 9; digit++)
+        {
+            bitboard->digits[digit] = SUDO_BITBOARD_ALL;
+        }
+        bitboard->unsolved = SUDO_BITBOARD_ALL;
+    }
+
+    // PLACE THE GIVENS
+    for (int cell = 0; cell < SUDO_BOARD_LEN && ENOERR == results; cell++)
+    {
+        if (SUDO_EMPTY_GRID != board[cell])
+        {
+            results = place_sudo_bitboard(bitboard, cell, board[cell] - '0');
+            if (ENOERR != results)
+            {
+                FPRINTF_ERR("%s Duplicate entry '%c' found at index %d\n", DEBUG_ERROR_STR,
+                            board[cell], cell);
+            }
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+int place_sudo_bitboard(sudo_bitboard_t *bitboard, int cell, int digit)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == bitboard || cell < 0 || cell >= SUDO_BOARD_LEN || digit < 1 || digit > 9)
+    {
+        results = EINVAL;  // Bad input
+    }
+    else if (false == SUDO_CELLSET_HAS(bitboard->unsolved, cell)
+             || false == SUDO_CELLSET_HAS(bitboard->digits[digit - 1], cell))
+    {
+        results = EINVAL;  // Not a legal play
+    }
+
+    // PLACE IT
+    if (ENOERR == results)
+    {
+        for (int i = 0; i < 9; i++)
+        {
+            SUDO_CELLSET_DEL(bitboard->digits[i], cell);
+        }
+        bitboard->digits[digit - 1] = andnot_sudo_cellset(bitboard->digits[digit - 1],
+                                                          sudo_peer_sets[cell]);
+        SUDO_CELLSET_ADD(bitboard->digits[digit - 1], cell);
+        SUDO_CELLSET_DEL(bitboard->unsolved, cell);
+    }
+
+    // DONE
+    return results;
+}
+
+
+SUDO_DISPATCH int propagate_sudo_bitboard(sudo_bitboard_t *bitboard, int *num_plays)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;          // Results of execution
+    int plays = 0;                 // Number of plays made
+    bool progress = true;          // Was a play made this pass?
+    sudo_cellset_t ones;           // Unsolved cells with at least one candidate
+    sudo_cellset_t twos;           // Unsolved cells with at least two candidates
+    sudo_cellset_t singles;        // Unsolved cells with exactly one candidate
+    sudo_cellset_t slots;          // A digit's cells in a unit
+    int cell = -1;                 // Cell to solve
+    int count = 0;                 // Number of cells in slots
+
+    // INPUT VALIDATION
+    if (NULL == bitboard)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // PROPAGATE
+    while (ENOERR == results && true == progress
+           && false == is_empty_sudo_cellset(bitboard->unsolved))
+    {
+        progress = false;
+        // Naked singles: count every plane at once
+        memset(&ones, 0, sizeof(ones));
+        memset(&twos, 0, sizeof(twos));
+        for (int i = 0; i < 9; i++)
+        {
+            twos = or_sudo_cellset(twos, and_sudo_cellset(ones, bitboard->digits[i]));
+            ones = or_sudo_cellset(ones, bitboard->digits[i]);
+        }
+        if (false == is_empty_sudo_cellset(andnot_sudo_cellset(bitboard->unsolved, ones)))
+        {
+            results = ENODATA;  // A cell ran out of candidates
+            break;
+        }
+        singles = andnot_sudo_cellset(and_sudo_cellset(bitboard->unsolved, ones), twos);
+        while ((cell = pop_sudo_cellset(&singles)) >= 0)
+        {
+            for (int digit = 1; digit <= 9; digit++)
+            {
+                // An earlier play this pass may have taken the cell's last candidate
+                if (SUDO_CELLSET_HAS(bitboard->digits[digit - 1], cell))
+                {
+                    place_sudo_bitboard(bitboard, cell, digit);
+                    plays++;
+                    progress = true;
+                    break;
+                }
+            }
+        }
+        if (true == progress)
+        {
+            continue;  // Naked singles are cheaper... look for more first
+        }
+        // Hidden singles: masked popcounts
+        for (int digit = 1; digit <= 9 && ENOERR == results; digit++)
+        {
+            for (int unit = 0; unit < SUDO_NUM_UNITS; unit++)
+            {
+                slots = and_sudo_cellset(bitboard->digits[digit - 1], sudo_unit_sets[unit]);
+                count = count_sudo_cellset(slots);
+                if (0 == count)
+                {
+                    results = ENODATA;  // The digit can't go anywhere in this unit
+                    break;
+                }
+                cell = pop_sudo_cellset(&slots);
+                if (1 == count && SUDO_CELLSET_HAS(bitboard->unsolved, cell))
+                {
+                    place_sudo_bitboard(bitboard, cell, digit);
+                    plays++;
+                    progress = true;
+                }
+            }
+        }
+    }
+
+    // DONE
+    if (NULL != num_plays)
+    {
+        *num_plays = plays;
+    }
+    return results;
+}
+
+
+int solve_bitboard(char board[81], int *num_nodes)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;       // Results of execution
+    int nodes = 0;              // Number of search nodes visited
+    sudo_bitboard_t bitboard;   // Bitboard for board
+
+    // INPUT VALIDATION
+    results = validate_board(board);
+
+    // SETUP
+    if (ENOERR == results)
+    {
+        results = init_sudo_bitboard(&bitboard, board);
+    }
+
+    // SOLVE IT
+    if (ENOERR == results)
+    {
+        results = search_bitboard(&bitboard, &nodes);
+        if (ENOERR == results)
+        {
+            export_sudo_bitboard(&bitboard, board);
+        }
+        FPRINTF_ERR("%s Bitboard search visited %d nodes\n", DEBUG_INFO_STR, nodes);
+    }
+
+    // DONE
+    if (NULL != num_nodes)
+    {
+        *num_nodes = nodes;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int pick_bitboard_cell(const sudo_bitboard_t *bitboard)
+{
+    // LOCAL VARIABLES
+    int best = -1;                                 // Unsolved cell with the fewest candidates
+    int best_count = 10;                           // Number of candidates for best
+    int count = 0;                                 // Number of candidates for a cell
+    sudo_cellset_t unsolved = bitboard->unsolved;  // Cells left to check
+    int cell = -1;                                 // Cell being checked
+
+    // PICK IT
+    while (best_count > 2 && (cell = pop_sudo_cellset(&unsolved)) >= 0)
+    {
+        count = 0;
+        for (int i = 0; i < 9; i++)
+        {
+            count += SUDO_CELLSET_HAS(bitboard->digits[i], cell);
+        }
+        if (count < best_count)
+        {
+            best = cell;
+            best_count = count;
+        }
+    }
+
+    // DONE
+    return best;
+}
+
+
+int search_bitboard(sudo_bitboard_t *bitboard, int *num_nodes)
+{
+    // LOCAL VARIABLES
+    int results = ENODATA;    // Results of execution
+    int cell = -1;            // Cell to branch on
+    sudo_bitboard_t child;    // Copy of bitboard for one branch
+
+    // PROPAGATE
+    (*num_nodes)++;
+    if (ENOERR != propagate_sudo_bitboard(bitboard, NULL))
+    {
+        goto done;  // Dead end
+    }
+    if (true == is_empty_sudo_cellset(bitboard->unsolved))
+    {
+        results = ENOERR;  // Solved
+        goto done;
+    }
+
+    // BRANCH
+    cell = pick_bitboard_cell(bitboard);
+    for (int digit = 1; digit <= 9 && ENOERR != results; digit++)
+    {
+        if (SUDO_CELLSET_HAS(bitboard->digits[digit - 1], cell))
+        {
+            child = *bitboard;
+            place_sudo_bitboard(&child, cell, digit);
+            results = search_bitboard(&child, num_nodes);
+            if (ENOERR == results)
+            {
+                *bitboard = child;  // Keep the solution
+            }
+        }
+    }
+
+    // DONE
+done:
+    return results;
+}
@@ -0,0 +1,350 @@
+/*
+ *  This library defines the single-digit chain (simple coloring, X-Chain) strategies on behalf of
+ *  SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <string.h>                         // memset()
+#include "sudo_cellset.h"                   // sudo_cellset_t
+#include "sudo_chains.h"                    // solve_chains()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, sudo_peer_sets, remove_sudo_cells()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Color every group of strong links for digit and apply the color wrap and color trap rules.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      digit: The digit, 1-9.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_coloring(sudo_state_t *state, int digit);
+
+/*
+ *  Description:
+ *      Run a bounded breadth-first X-Chain search for digit from every cell with a strong link.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      digit: The digit, 1-9.
+ *      num_nodes: [In/Out] Add the number of nodes visited to this.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_x_chains(sudo_state_t *state, int digit, int *num_nodes);
+
+/*
+ *  Description:
+ *      Gather the cells that have digit as a candidate.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      digit: The digit, 1-9.
+ *
+ *  Returns:
+ *      The cell set.
+ */
+sudo_cellset_t gather_digit_cells(const sudo_state_t *state, int digit);
+
+/*
+ *  Description:
+ *      Gather the cells that share a strong link on digit with cell.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      cell: The cell index, 0-80.
+ *      digit: The digit, 1-9.
+ *      partners: [Out] Room for the (up to three) partner cells.
+ *
+ *  Returns:
+ *      The number of partners found.
+ */
+int gather_strong_partners(const sudo_state_t *state, int cell, int digit, int partners[3]);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_chains(sudo_state_t *state, sudo_chain_counters_t *counters, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;    // Results of execution
+    int coloring_elims = 0;  // Number of candidates eliminated by simple coloring
+    int xchain_elims = 0;    // Number of candidates eliminated by X-Chains
+    int num_nodes = 0;       // Number of nodes the X-Chain search visited
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        for (int digit = 1; digit <= 9 && false == state->contradiction; digit++)
+        {
+            coloring_elims += find_coloring(state, digit);
+        }
+        for (int digit = 1; digit <= 9 && 0 == coloring_elims && 0 == xchain_elims
+             && false == state->contradiction; digit++)
+        {
+            xchain_elims += find_x_chains(state, digit, &num_nodes);
+        }
+        FPRINTF_ERR("%s Chains eliminated %d candidates\n", DEBUG_INFO_STR,
+                    coloring_elims + xchain_elims);
+        results = (coloring_elims + xchain_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (ENOERR == results || ENODATA == results)
+    {
+        if (NULL != counters)
+        {
+            counters->calls++;
+            counters->coloring_elims += coloring_elims;
+            counters->xchain_elims += xchain_elims;
+            counters->nodes_visited += num_nodes;
+        }
+    }
+    if (NULL != num_elims)
+    {
+        *num_elims = coloring_elims + xchain_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int find_coloring(sudo_state_t *state, int digit)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;              // Number of candidates eliminated
+    uint8_t color[81] = { 0 };      // 0 for uncolored, otherwise 1 or 2
+    uint8_t queue[81] = { 0 };      // Cells of the current group waiting to be expanded
+    int head = 0;                   // Index of the next cell to expand
+    int tail = 0;                   // Index of the next free slot in queue
+    int partners[3] = { 0 };        // Strong link partners of a cell
+    int num_partners = 0;           // Number of entries in partners
+    sudo_cellset_t digit_cells;     // Cells with digit as a candidate
+    sudo_cellset_t group[2];        // Cells of each color in the current group
+    sudo_cellset_t seen[2];         // Cells that see each color in the current group
+    sudo_cellset_t targets;         // Cells to eliminate digit from
+    int cell = -1;                  // Current cell
+    int start = -1;                 // First cell of the current group
+
+    // SETUP
+    digit_cells = gather_digit_cells(state, digit);
+
+    // COLOR THEM
+    for (start = 0; start < SUDO_BOARD_LEN && 0 == num_elims; start++)
+    {
+        if (color[start] || 0 == gather_strong_partners(state, start, digit, partners))
+        {
+            continue;  // Already colored or not part of a strong link
+        }
+        memset(group, 0, sizeof(group));
+        memset(seen, 0, sizeof(seen));
+        head = tail = 0;
+        color[start] = 1;
+        queue[tail++] = start;
+        while (head < tail)
+        {
+            cell = queue[head++];
+            SUDO_CELLSET_ADD(group[color[cell] - 1], cell);
+            seen[color[cell] - 1].bits[0] |= sudo_peer_sets[cell].bits[0];
+            seen[color[cell] - 1].bits[1] |= sudo_peer_sets[cell].bits[1];
+            num_partners = gather_strong_partners(state, cell, digit, partners);
+            for (int i = 0; i < num_partners; i++)
+            {
+                if (0 == color[partners[i]])
+                {
+                    color[partners[i]] = 3 - color[cell];
+                    queue[tail++] = partners[i];
+                }
+            }
+        }
+        // Color wrap: a color that sees itself is false
+        for (int c = 0; c < 2 && 0 == num_elims; c++)
+        {
+            if (false == is_empty_sudo_cellset(and_sudo_cellset(group[c], seen[c])))
+            {
+                num_elims += remove_sudo_cells(state, group[c], digit);
+            }
+        }
+        // Color trap: a cell that sees both colors is false
+        if (0 == num_elims)
+        {
+            targets = and_sudo_cellset(and_sudo_cellset(seen[0], seen[1]), digit_cells);
+            targets.bits[0] &= ~(group[0].bits[0] | group[1].bits[0]);
+            targets.bits[1] &= ~(group[0].bits[1] | group[1].bits[1]);
+            num_elims += remove_sudo_cells(state, targets, digit);
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_x_chains(sudo_state_t *state, int digit, int *num_nodes)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;              // Number of candidates eliminated
+    uint8_t depth[2][81];           // Links followed to turn each cell off (0) or on (1)
+    uint8_t queue[2 * 81] = { 0 };  // (cell * 2) + on, waiting to be expanded
+    int head = 0;                   // Index of the next entry to expand
+    int tail = 0;                   // Index of the next free slot in queue
+    int partners[3] = { 0 };        // Strong link partners of a cell
+    int num_partners = 0;           // Number of entries in partners
+    sudo_cellset_t digit_cells;     // Cells with digit as a candidate
+    sudo_cellset_t weak;            // Peers of a cell that still have digit as a candidate
+    sudo_cellset_t targets;         // Cells to eliminate digit from
+    int cell = -1;                  // Current cell
+    int on = 0;                     // Is the current cell on (1) or off (0)?
+    int next = -1;                  // Next cell
+
+    // SETUP
+    digit_cells = gather_digit_cells(state, digit);
+
+    // FOLLOW THEM
+    for (int start = 0; start < SUDO_BOARD_LEN && 0 == num_elims; start++)
+    {
+        if (0 == gather_strong_partners(state, start, digit, partners))
+        {
+            continue;  // A chain must start with a strong link
+        }
+        memset(depth, 0xFF, sizeof(depth));
+        head = tail = 0;
+        depth[0][start] = 0;
+        queue[tail++] = start * 2;  // Assume start is off
+        while (head < tail)
+        {
+            cell = queue[head] / 2;
+            on = queue[head] % 2;
+            head++;
+            (*num_nodes)++;
+            if (depth[on][cell] >= SUDO_MAX_CHAIN)
+            {
+                continue;  // Too long
+            }
+            if (0 == on)
+            {
+                // Strong links: if this cell is off, its partners are on
+                num_partners = gather_strong_partners(state, cell, digit, partners);
+                for (int i = 0; i < num_partners; i++)
+                {
+                    if (0xFF == depth[1][partners[i]])
+                    {
+                        depth[1][partners[i]] = depth[0][cell] + 1;
+                        queue[tail++] = (partners[i] * 2) + 1;
+                    }
+                }
+            }
+            else
+            {
+                // Weak links: if this cell is on, its peers are off
+                weak = and_sudo_cellset(sudo_peer_sets[cell], digit_cells);
+                while ((next = pop_sudo_cellset(&weak)) >= 0)
+                {
+                    if (0xFF == depth[0][next])
+                    {
+                        depth[0][next] = depth[1][cell] + 1;
+                        queue[tail++] = next * 2;
+                    }
+                }
+            }
+        }
+        // If start being off turns start on, start holds the digit
+        if (0xFF != depth[1][start])
+        {
+            for (uint16_t tmp = state->cands[start] & ~SUDO_DIGIT_BIT(digit); tmp; tmp &= tmp - 1)
+            {
+                if (ENOERR == remove_sudo_candidate(state, start, SUDO_CTZ(tmp) + 1))
+                {
+                    num_elims++;
+                }
+            }
+            continue;
+        }
+        // Either start or each cell that ended up on holds the digit
+        for (cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            if (0xFF != depth[1][cell])
+            {
+                targets = and_sudo_cellset(and_sudo_cellset(sudo_peer_sets[start],
+                                                            sudo_peer_sets[cell]), digit_cells);
+                num_elims += remove_sudo_cells(state, targets, digit);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+sudo_cellset_t gather_digit_cells(const sudo_state_t *state, int digit)
+{
+    // LOCAL VARIABLES
+    sudo_cellset_t digit_cells = { { 0, 0 } };  // Cells with digit as a candidate
+
+    // GATHER THEM
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (state->cands[cell] & SUDO_DIGIT_BIT(digit))
+        {
+            SUDO_CELLSET_ADD(digit_cells, cell);
+        }
+    }
+
+    // DONE
+    return digit_cells;
+}
+
+
+int gather_strong_partners(const sudo_state_t *state, int cell, int digit, int partners[3])
+{
+    // LOCAL VARIABLES
+    int num_partners = 0;  // Number of partners found
+    int unit = 0;          // Unit index
+    uint16_t slots = 0;    // The digit's slots in unit, less cell's
+
+    // GATHER THEM
+    if (state->cands[cell] & SUDO_DIGIT_BIT(digit))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            unit = sudo_cell_units[cell][i];
+            if (state->strong_units[digit - 1] & (1UL << unit))
+            {
+                slots = state->unit_pos[unit][digit - 1] & ~(1 << sudo_cell_slots[cell][i]);
+                partners[num_partners++] = sudo_unit_cells[unit][SUDO_CTZ(slots)];
+            }
+        }
+    }
+
+    // DONE
+    return num_partners;
+}
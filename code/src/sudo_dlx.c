@@ -0,0 +1,501 @@
+/*
+ *  This library defines a Dancing Links (Algorithm X) exact cover solver on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdbool.h>                        // bool, false, true
+#include <stdint.h>                         // uint16_t
+#include <string.h>                         // memcpy()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_dlx.h"                       // sudo_dlx_callback_t
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "sudo_validation.h"                // validate_board()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/* DLX MACROS */
+// SUDO_DLX_ROWS, SUDO_DLX_COLS
+#define SUDO_DLX_ROWS 729  // One per cell and digit
+#define SUDO_DLX_COLS 324  // Cell, row/digit, col/digit, and grid/digit constraints
+// SUDO_DLX_ROOT
+#define SUDO_DLX_ROOT 0  // The root node, followed by the column headers
+// SUDO_DLX_NODES
+#define SUDO_DLX_NODES (1 + SUDO_DLX_COLS + (SUDO_DLX_ROWS * 4))  // Root, headers, and row nodes
+
+/*
+ *  A node arena.  Node 0 is the root, nodes 1-324 are the column headers, and each row
+ *  owns four consecutive nodes after that.
+ */
+typedef struct
+{
+    uint16_t left[SUDO_DLX_NODES];     // Left neighbor of each node
+    uint16_t right[SUDO_DLX_NODES];    // Right neighbor of each node
+    uint16_t up[SUDO_DLX_NODES];       // Up neighbor of each node
+    uint16_t down[SUDO_DLX_NODES];     // Down neighbor of each node
+    uint16_t col[SUDO_DLX_NODES];      // Column header of each node
+    uint16_t row[SUDO_DLX_NODES];      // Row index of each row node: (cell * 9) + (digit - 1)
+    uint16_t size[SUDO_DLX_COLS + 1];  // Number of rows left in each column, by header node
+    bool covered[SUDO_DLX_COLS + 1];   // Has each column been covered, by header node
+    bool ready;                        // Has the arena been linked up?
+} sudo_dlx_arena_t;
+
+/*
+ *  The state of one search.
+ */
+typedef struct
+{
+    char board[81];                // The givens plus the rows selected so far
+    int limit;                     // Stop after this many solutions
+    int num_solutions;             // Number of solutions found
+    sudo_dlx_callback_t callback;  // [Optional] Called with each solution
+    void *context;                 // Passed through to callback
+    bool stop;                     // Has the search been asked to stop?
+} sudo_dlx_search_t;
+
+_Thread_local sudo_dlx_arena_t sudo_dlx_arena;  // This thread's node arena
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Remove a column from the header list and every row that intersects it from the other
+ *      columns.
+ *
+ *  Args:
+ *      header: The column header node.
+ *
+ *  Returns:
+ *      None
+ */
+void cover_dlx_column(int header);
+
+/*
+ *  Description:
+ *      Link up this thread's node arena on first use.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      None
+ */
+void init_dlx_arena(void);
+
+/*
+ *  Description:
+ *      Cover the givens, search, and uncover everything.
+ *
+ *  Args:
+ *      board: A game board of 81 characters.
+ *      search: [In/Out] The search to run.  board is copied in.
+ *
+ *  Returns:
+ *      ENOERR on success, EINVAL for bad input.
+ */
+int run_dlx(const char board[81], sudo_dlx_search_t *search);
+
+/*
+ *  Description:
+ *      Recursively search for exact covers.  Every cover made is undone before returning.
+ *
+ *  Args:
+ *      search: [In/Out] The search in progress.
+ *
+ *  Returns:
+ *      None
+ */
+void search_dlx(sudo_dlx_search_t *search);
+
+/*
+ *  Description:
+ *      Cover the columns of a row's other nodes, as if the row was selected.
+ *
+ *  Args:
+ *      node: One of the row's nodes.
+ *
+ *  Returns:
+ *      None
+ */
+void select_dlx_row(int node);
+
+/*
+ *  Description:
+ *      Undo cover_dlx_column().
+ *
+ *  Args:
+ *      header: The column header node.
+ *
+ *  Returns:
+ *      None
+ */
+void uncover_dlx_column(int header);
+
+/*
+ *  Description:
+ *      Undo select_dlx_row().
+ *
+ *  Args:
+ *      node: The same node passed to select_dlx_row().
+ *
+ *  Returns:
+ *      None
+ */
+void unselect_dlx_row(int node);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int count_dlx_solutions(const char board[81], int limit, int *num_solutions)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;              // Results of execution
+    sudo_dlx_search_t search = { 0 };  // The search to run
+
+    // INPUT VALIDATION
+    if (limit < 1 || NULL == num_solutions)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // COUNT THEM
+    if (ENOERR == results)
+    {
+        search.limit = limit;
+        results = run_dlx(board, &search);
+    }
+
+    // DONE
+    if (ENOERR == results)
+    {
+        *num_solutions = search.num_solutions;
+    }
+    return results;
+}
+
+
+int enumerate_dlx_solutions(const char board[81], sudo_dlx_callback_t callback, void *context,
+                            int *num_solutions)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;              // Results of execution
+    sudo_dlx_search_t search = { 0 };  // The search to run
+
+    // INPUT VALIDATION
+    if (NULL == callback)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ENUMERATE THEM
+    if (ENOERR == results)
+    {
+        search.limit = -1;  // No limit
+        search.callback = callback;
+        search.context = context;
+        results = run_dlx(board, &search);
+    }
+
+    // DONE
+    if (ENOERR == results && NULL != num_solutions)
+    {
+        *num_solutions = search.num_solutions;
+    }
+    return results;
+}
+
+
+int find_dlx_solution(char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;              // Results of execution
+    sudo_dlx_search_t search = { 0 };  // The search to run
+
+    // FIND IT
+    search.limit = 1;
+    results = run_dlx(board, &search);
+
+    // DONE
+    if (ENOERR == results)
+    {
+        if (1 == search.num_solutions)
+        {
+            memcpy(board, search.board, SUDO_BOARD_LEN);
+        }
+        else
+        {
+            results = ENODATA;  // No solution
+        }
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+void cover_dlx_column(int header)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+
+    // COVER IT
+    arena->right[arena->left[header]] = arena->right[header];
+    arena->left[arena->right[header]] = arena->left[header];
+    for (int i = arena->down[header]; i != header; i = arena->down[i])
+    {
+        for (int j = arena->right[i]; j != i; j = arena->right[j])
+        {
+            arena->down[arena->up[j]] = arena->down[j];
+            arena->up[arena->down[j]] = arena->up[j];
+            arena->size[arena->col[j]]--;
+        }
+    }
+    arena->covered[header] = true;
+
+    // DONE
+    return;
+}
+
+
+void init_dlx_arena(void)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+    int headers[4] = { 0 };                     // Column headers of a row's constraints
+    int node = 0;                               // First node of a row
+    int cell = 0;                               // Cell of a row
+    int digit = 0;                              // Digit index (digit - 1) of a row
+
+    // LINK IT UP
+    if (false == arena->ready)
+    {
+        // Root and column headers form a circular list
+        for (int i = 0; i <= SUDO_DLX_COLS; i++)
+        {
+            arena->left[i] = (0 == i) ? SUDO_DLX_COLS : i - 1;
+            arena->right[i] = (SUDO_DLX_COLS == i) ? 0 : i + 1;
+            arena->up[i] = i;
+            arena->down[i] = i;
+            arena->col[i] = i;
+            arena->size[i] = 0;
+            arena->covered[i] = false;
+        }
+        // Each row gets four nodes, one per constraint, appended to the bottom of its columns
+        for (int row = 0; row < SUDO_DLX_ROWS; row++)
+        {
+            cell = row / 9;
+            digit = row % 9;
+            headers[0] = 1 + cell;
+            headers[1] = 1 + 81 + ((cell / 9) * 9) + digit;
+            headers[2] = 1 + 162 + ((cell % 9) * 9) + digit;
+            headers[3] = 1 + 243 + ((((cell / 27) * 3) + ((cell % 9) / 3)) * 9) + digit;
+            node = 1 + SUDO_DLX_COLS + (row * 4);
+            for (int i = 0; i < 4; i++)
+            {
+                arena->left[node + i] = node + ((i + 3) % 4);
+                arena->right[node + i] = node + ((i + 1) % 4);
+                arena->col[node + i] = headers[i];
+                arena->row[node + i] = row;
+                arena->up[node + i] = arena->up[headers[i]];
+                arena->down[node + i] = headers[i];
+                arena->down[arena->up[headers[i]]] = node + i;
+                arena->up[headers[i]] = node + i;
+                arena->size[headers[i]]++;
+            }
+        }
+        arena->ready = true;
+    }
+
+    // DONE
+    return;
+}
+
+
+int run_dlx(const char board[81], sudo_dlx_search_t *search)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                       // Results of execution
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+    int givens[81] = { 0 };                     // First node of each given's row
+    int num_givens = 0;                         // Number of entries in givens
+    int node = 0;                               // First node of a given's row
+
+    // INPUT VALIDATION
+    results = validate_board(board);
+
+    // COVER THE GIVENS
+    if (ENOERR == results)
+    {
+        init_dlx_arena();
+        memcpy(search->board, board, SUDO_BOARD_LEN);
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            if (SUDO_EMPTY_GRID == board[cell])
+            {
+                continue;  // Not a given
+            }
+            node = 1 + SUDO_DLX_COLS + (((cell * 9) + (board[cell] - '1')) * 4);
+            for (int i = 0; i < 4; i++)
+            {
+                if (true == arena->covered[arena->col[node + i]])
+                {
+                    results = EINVAL;  // Duplicate entry
+                    FPRINTF_ERR("%s Duplicate entry '%c' found at index %d\n", DEBUG_ERROR_STR,
+                                board[cell], cell);
+                    break;
+                }
+            }
+            if (ENOERR != results)
+            {
+                break;
+            }
+            cover_dlx_column(arena->col[node]);
+            select_dlx_row(node);
+            givens[num_givens++] = node;
+        }
+    }
+
+    // SEARCH
+    if (ENOERR == results)
+    {
+        search_dlx(search);
+    }
+
+    // UNCOVER THE GIVENS
+    while (num_givens > 0)
+    {
+        node = givens[--num_givens];
+        unselect_dlx_row(node);
+        uncover_dlx_column(arena->col[node]);
+    }
+
+    // DONE
+    return results;
+}
+
+
+void search_dlx(sudo_dlx_search_t *search)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+    int header = 0;                             // Column with the fewest rows left
+    int cell = 0;                               // Cell of a candidate row
+
+    // SOLVED?
+    if (SUDO_DLX_ROOT == arena->right[SUDO_DLX_ROOT])
+    {
+        search->num_solutions++;
+        if (NULL != search->callback && ENOERR != search->callback(search->board, search->context))
+        {
+            search->stop = true;  // The caller has seen enough
+        }
+        if (search->num_solutions == search->limit)
+        {
+            search->stop = true;  // Found enough
+        }
+        goto done;
+    }
+
+    // CHOOSE A COLUMN
+    header = arena->right[SUDO_DLX_ROOT];
+    for (int i = arena->right[header]; i != SUDO_DLX_ROOT && arena->size[header] > 1;
+         i = arena->right[i])
+    {
+        if (arena->size[i] < arena->size[header])
+        {
+            header = i;
+        }
+    }
+    if (0 == arena->size[header])
+    {
+        goto done;  // Dead end
+    }
+
+    // TRY EACH ROW
+    cover_dlx_column(header);
+    for (int i = arena->down[header]; i != header && false == search->stop; i = arena->down[i])
+    {
+        cell = arena->row[i] / 9;
+        search->board[cell] = '1' + (arena->row[i] % 9);
+        select_dlx_row(i);
+        search_dlx(search);
+        unselect_dlx_row(i);
+        if (false == search->stop)
+        {
+            search->board[cell] = SUDO_EMPTY_GRID;  // Keep the solution on the way out
+        }
+    }
+    uncover_dlx_column(header);
+
+    // DONE
+done:
+    return;
+}
+
+
+void select_dlx_row(int node)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+
+    // SELECT IT
+    for (int j = arena->right[node]; j != node; j = arena->right[j])
+    {
+        cover_dlx_column(arena->col[j]);
+    }
+
+    // DONE
+    return;
+}
+
+
+void uncover_dlx_column(int header)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+
+    // UNCOVER IT
+    arena->covered[header] = false;
+    for (int i = arena->up[header]; i != header; i = arena->up[i])
+    {
+        for (int j = arena->left[i]; j != i; j = arena->left[j])
+        {
+            arena->size[arena->col[j]]++;
+            arena->down[arena->up[j]] = j;
+            arena->up[arena->down[j]] = j;
+        }
+    }
+    arena->right[arena->left[header]] = header;
+    arena->left[arena->right[header]] = header;
+
+    // DONE
+    return;
+}
+
+
+void unselect_dlx_row(int node)
+{
+    // LOCAL VARIABLES
+    sudo_dlx_arena_t *arena = &sudo_dlx_arena;  // This thread's node arena
+
+    // UNSELECT IT
+    for (int j = arena->left[node]; j != node; j = arena->left[j])
+    {
+        uncover_dlx_column(arena->col[j]);
+    }
+
+    // DONE
+    return;
+}
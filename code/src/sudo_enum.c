@@ -0,0 +1,205 @@
+/*
+ *  This library defines a lazy solution enumerator on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdbool.h>                        // bool, false, true
+#include <stddef.h>                         // size_t
+#include "sudo_debug.h"                     // MODULE_*LOAD()
+#include "sudo_enum.h"                      // sudo_enum_t
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // init_sudo_state(), play_sudo_digit()
+#include "sudo_validation.h"                // validate_board()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Find the empty cell with the fewest candidates.
+ *
+ *  Args:
+ *      state: The solver state.
+ *
+ *  Returns:
+ *      A cell index 0-80, or -1 if the board is full.
+ */
+int pick_enum_cell(const sudo_state_t *state);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int destroy_sudo_enum(sudo_enum_t *iter)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == iter)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // DESTROY IT
+    if (ENOERR == results)
+    {
+        start_sudo_trail(&iter->state, NULL);
+        iter->depth = 0;
+        iter->at_solution = false;
+        iter->done = true;
+    }
+
+    // DONE
+    return results;
+}
+
+
+int init_sudo_enum(sudo_enum_t *iter, const char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == iter)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+    else
+    {
+        results = validate_board(board);  // Full validation
+    }
+
+    // SETUP
+    if (ENOERR == results)
+    {
+        results = init_sudo_state(&iter->state, board);
+    }
+    if (ENOERR == results)
+    {
+        start_sudo_trail(&iter->state, &iter->trail);
+        propagate_sudo_singles(&iter->state, SUDO_BOARD_LEN, NULL);  // The root node
+        iter->depth = 0;
+        iter->at_solution = false;
+        iter->done = false;
+        iter->num_solutions = 0;
+    }
+
+    // DONE
+    return results;
+}
+
+
+int next_sudo_enum(sudo_enum_t *iter, char solution[81])
+{
+    // LOCAL VARIABLES
+    int results = ENODATA;       // Results of execution
+    sudo_state_t *state = NULL;  // The search's current node
+    bool backtrack = false;      // Leave the current node instead of expanding it?
+    int cell = -1;               // Cell to branch on
+    int level = 0;               // Index of the deepest open level
+    int digit = 0;               // Candidate to try next
+
+    // INPUT VALIDATION
+    if (NULL == iter || NULL == solution)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+        goto done;
+    }
+    state = &iter->state;
+    backtrack = iter->at_solution;  // Resume past the last solution returned
+    iter->at_solution = false;
+
+    // SEARCH
+    while (false == iter->done)
+    {
+        if (false == backtrack)
+        {
+            // Expand the current node
+            if (true == state->contradiction)
+            {
+                backtrack = true;  // Dead end
+                continue;
+            }
+            if (0 == state->num_empty)
+            {
+                export_sudo_state(state, solution);
+                iter->at_solution = true;
+                iter->num_solutions++;
+                results = ENOERR;  // Found one
+                break;
+            }
+            cell = pick_enum_cell(state);
+            iter->cells[iter->depth] = cell;
+            iter->untried[iter->depth] = state->cands[cell];
+            iter->depth++;
+        }
+        else if (0 == iter->depth)
+        {
+            iter->done = true;  // Back at the root: every branch has been tried
+            break;
+        }
+        else
+        {
+            pop_sudo_trail(state);  // Undo the deepest level's current branch
+        }
+        // Try the deepest level's next candidate
+        level = iter->depth - 1;
+        if (0 == iter->untried[level])
+        {
+            iter->depth--;  // Exhausted: leave the parent's branch too
+            backtrack = true;
+            continue;
+        }
+        digit = SUDO_CTZ(iter->untried[level]) + 1;
+        iter->untried[level] &= iter->untried[level] - 1;
+        push_sudo_trail(state);
+        play_sudo_digit(state, iter->cells[level], digit);
+        propagate_sudo_singles(state, SUDO_BOARD_LEN, NULL);  // Always reaches a fixed point
+        backtrack = false;
+    }
+
+    // DONE
+done:
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int pick_enum_cell(const sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int best = -1;        // Empty cell with the fewest candidates
+    int best_count = 10;  // Number of candidates for best
+    int count = 0;        // Number of candidates for a cell
+
+    // PICK IT
+    for (int cell = 0; cell < SUDO_BOARD_LEN && best_count > 2; cell++)
+    {
+        if (0 == state->cells[cell])
+        {
+            count = SUDO_POPCOUNT(state->cands[cell]);
+            if (count < best_count)
+            {
+                best = cell;
+                best_count = count;
+            }
+        }
+    }
+
+    // DONE
+    return best;
+}
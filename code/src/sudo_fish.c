@@ -0,0 +1,140 @@
+/*
+ *  This library defines the basic fish (X-Wing, Swordfish, Jellyfish) strategy on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_fish.h"                      // solve_fish()
+#include "sudo_macros.h"                    // ENOERR, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, remove_sudo_slots()
+#include "sudo_subsets.h"                   // sudo_combos, sudo_num_combos
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Look for fish of one size and digit.  A row's slot mask is a mask of cols and a col's slot
+ *      mask is a mask of rows, so base and cover sets are both 9-bit masks.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      base_unit: The unit index of the first base set: SUDO_ROW_UNIT(0) or SUDO_COL_UNIT(0).
+ *      cover_unit: The unit index of the first cover set: SUDO_COL_UNIT(0) or SUDO_ROW_UNIT(0).
+ *      size: The size of the fish, 2 through SUDO_MAX_FISH.
+ *      digit: The digit, 1-9.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_fish(sudo_state_t *state, int base_unit, int cover_unit, int size, int digit);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_fish(sudo_state_t *state, int max_size, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int total_elims = 0;   // Number of candidates eliminated
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+    else if (max_size < 2 || max_size > SUDO_MAX_FISH)
+    {
+        results = EINVAL;  // Unsupported fish
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        for (int size = 2; size <= max_size && 0 == total_elims; size++)
+        {
+            for (int digit = 1; digit <= 9 && false == state->contradiction; digit++)
+            {
+                total_elims += find_fish(state, SUDO_ROW_UNIT(0), SUDO_COL_UNIT(0), size, digit);
+                total_elims += find_fish(state, SUDO_COL_UNIT(0), SUDO_ROW_UNIT(0), size, digit);
+            }
+        }
+        FPRINTF_ERR("%s Fish eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int find_fish(sudo_state_t *state, int base_unit, int cover_unit, int size, int digit)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;        // Number of candidates eliminated
+    uint16_t eligible = 0;    // Base sets where the digit has 1 to size slots left
+    uint16_t base = 0;        // Combination of base sets to check
+    uint16_t cover = 0;       // Union of the base sets' slot masks
+    uint16_t line_slots = 0;  // The digit's slots in one base or cover set
+
+    // SETUP
+    for (int line = 0; line < 9; line++)
+    {
+        line_slots = state->unit_pos[base_unit + line][digit - 1];
+        if (line_slots && SUDO_POPCOUNT(line_slots) <= size)
+        {
+            eligible |= 1 << line;
+        }
+    }
+
+    // FIND THEM
+    if (SUDO_POPCOUNT(eligible) >= size)
+    {
+        for (int i = 0; i < sudo_num_combos[size]; i++)
+        {
+            base = sudo_combos[size][i];
+            if (base & ~eligible)
+            {
+                continue;  // One of these lines can't be a base set
+            }
+            cover = 0;
+            for (uint16_t tmp = base; tmp; tmp &= tmp - 1)
+            {
+                cover |= state->unit_pos[base_unit + SUDO_CTZ(tmp)][digit - 1];
+            }
+            if (SUDO_POPCOUNT(cover) != size)
+            {
+                continue;  // Not a fish
+            }
+            // The digit can't go anywhere else in the cover sets
+            for (uint16_t tmp = cover; tmp; tmp &= tmp - 1)
+            {
+                line_slots = state->unit_pos[cover_unit + SUDO_CTZ(tmp)][digit - 1];
+                num_elims += remove_sudo_slots(state, cover_unit + SUDO_CTZ(tmp),
+                                               line_slots & ~base, digit);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
@@ -0,0 +1,163 @@
+/*
+ *  This library defines the forcing chain strategy on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stddef.h>                         // size_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_forcing.h"                   // solve_forcing()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, propagate_sudo_singles()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Play out two branches, each placing a digit in a cell, and keep what holds in both.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      cells: The cell each branch plays in.
+ *      digits: The digit each branch plays.
+ *      budget: The most plays each branch may propagate.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int force_branches(sudo_state_t *state, const int cells[2], const int digits[2], int budget);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_forcing(sudo_state_t *state, int budget, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;    // Results of execution
+    int total_elims = 0;     // Number of candidates eliminated
+    int cells[2] = { 0 };    // The cell each branch plays in
+    int digits[2] = { 0 };   // The digit each branch plays
+    uint16_t slots = 0;      // A bilocal digit's slots in a unit
+
+    // INPUT VALIDATION
+    if (NULL == state || budget < 0)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        // Bivalue cells
+        for (int cell = 0; cell < SUDO_BOARD_LEN && 0 == total_elims; cell++)
+        {
+            if (2 == SUDO_POPCOUNT(state->cands[cell]))
+            {
+                cells[0] = cells[1] = cell;
+                digits[0] = SUDO_CTZ(state->cands[cell]) + 1;
+                digits[1] = SUDO_CTZ(state->cands[cell] & (state->cands[cell] - 1)) + 1;
+                total_elims += force_branches(state, cells, digits, budget);
+            }
+        }
+        // Bilocal units
+        for (int digit = 1; digit <= 9 && 0 == total_elims; digit++)
+        {
+            for (uint32_t units = state->strong_units[digit - 1]; units && 0 == total_elims;
+                 units &= units - 1)
+            {
+                slots = state->unit_pos[SUDO_CTZ(units)][digit - 1];
+                cells[0] = sudo_unit_cells[SUDO_CTZ(units)][SUDO_CTZ(slots)];
+                cells[1] = sudo_unit_cells[SUDO_CTZ(units)][SUDO_CTZ(slots & (slots - 1))];
+                digits[0] = digits[1] = digit;
+                total_elims += force_branches(state, cells, digits, budget);
+            }
+        }
+        FPRINTF_ERR("%s Forcing chains eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int force_branches(sudo_state_t *state, const int cells[2], const int digits[2], int budget)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;        // Number of candidates eliminated
+    sudo_state_t branch[2];   // Copies of state to play each branch out on
+    uint16_t left = 0;        // A cell's options left standing by either branch
+    uint16_t gone = 0;        // A cell's candidates neither branch left standing
+
+    // PLAY THEM OUT
+    for (int i = 0; i < 2; i++)
+    {
+        branch[i] = *state;
+        place_sudo_digit(&branch[i], cells[i], digits[i]);
+        propagate_sudo_singles(&branch[i], budget, NULL);  // ENODATA just means a shallower look
+    }
+
+    // KEEP WHAT HOLDS
+    if (true == branch[0].contradiction && true == branch[1].contradiction)
+    {
+        state->contradiction = true;  // Neither branch can be true
+    }
+    else if (true == branch[0].contradiction || true == branch[1].contradiction)
+    {
+        // Refute the branch that failed
+        for (int i = 0; i < 2; i++)
+        {
+            if (true == branch[i].contradiction
+                && ENOERR == remove_sudo_candidate(state, cells[i], digits[i]))
+            {
+                num_elims++;
+            }
+        }
+    }
+    else
+    {
+        // Eliminate whatever neither branch left standing
+        for (int cell = 0; cell < SUDO_BOARD_LEN && false == state->contradiction; cell++)
+        {
+            if (0 == state->cands[cell])
+            {
+                continue;  // Nothing to eliminate
+            }
+            left = 0;
+            for (int i = 0; i < 2; i++)
+            {
+                left |= branch[i].cells[cell] ? SUDO_DIGIT_BIT(branch[i].cells[cell])
+                                              : branch[i].cands[cell];
+            }
+            for (gone = state->cands[cell] & ~left; gone; gone &= gone - 1)
+            {
+                if (ENOERR == remove_sudo_candidate(state, cell, SUDO_CTZ(gone) + 1))
+                {
+                    num_elims++;
+                }
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
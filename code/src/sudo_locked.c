@@ -0,0 +1,147 @@
+/*
+ *  This library defines the locked candidates (pointing and claiming) strategy on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_locked.h"                    // solve_locked_candidates()
+#include "sudo_macros.h"                    // ENOERR
+#include "sudo_state.h"                     // sudo_state_t, remove_sudo_slots()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/*
+ *  One of the 54 intersections between a 3x3 grid and a row or col.
+ */
+typedef struct
+{
+    uint8_t box_unit;    // Unit index of the grid
+    uint8_t line_unit;   // Unit index of the row or col
+    uint16_t box_mask;   // Slots of the intersection within the grid
+    uint16_t line_mask;  // Slots of the intersection within the row or col
+} sudo_intersection_t;
+
+// Every grid/row intersection followed by every grid/col intersection
+const sudo_intersection_t sudo_intersections[54] = {
+    { 18,  0, 0x007, 0x007 },  // grid 1, row 1
+    { 18,  1, 0x038, 0x007 },  // grid 1, row 2
+    { 18,  2, 0x1C0, 0x007 },  // grid 1, row 3
+    { 19,  0, 0x007, 0x038 },  // grid 2, row 1
+    { 19,  1, 0x038, 0x038 },  // grid 2, row 2
+    { 19,  2, 0x1C0, 0x038 },  // grid 2, row 3
+    { 20,  0, 0x007, 0x1C0 },  // grid 3, row 1
+    { 20,  1, 0x038, 0x1C0 },  // grid 3, row 2
+    { 20,  2, 0x1C0, 0x1C0 },  // grid 3, row 3
+    { 21,  3, 0x007, 0x007 },  // grid 4, row 4
+    { 21,  4, 0x038, 0x007 },  // grid 4, row 5
+    { 21,  5, 0x1C0, 0x007 },  // grid 4, row 6
+    { 22,  3, 0x007, 0x038 },  // grid 5, row 4
+    { 22,  4, 0x038, 0x038 },  // grid 5, row 5
+    { 22,  5, 0x1C0, 0x038 },  // grid 5, row 6
+    { 23,  3, 0x007, 0x1C0 },  // grid 6, row 4
+    { 23,  4, 0x038, 0x1C0 },  // grid 6, row 5
+    { 23,  5, 0x1C0, 0x1C0 },  // grid 6, row 6
+    { 24,  6, 0x007, 0x007 },  // grid 7, row 7
+    { 24,  7, 0x038, 0x007 },  // grid 7, row 8
+    { 24,  8, 0x1C0, 0x007 },  // grid 7, row 9
+    { 25,  6, 0x007, 0x038 },  // grid 8, row 7
+    { 25,  7, 0x038, 0x038 },  // grid 8, row 8
+    { 25,  8, 0x1C0, 0x038 },  // grid 8, row 9
+    { 26,  6, 0x007, 0x1C0 },  // grid 9, row 7
+    { 26,  7, 0x038, 0x1C0 },  // grid 9, row 8
+    { 26,  8, 0x1C0, 0x1C0 },  // grid 9, row 9
+    { 18,  9, 0x049, 0x007 },  // grid 1, col 1
+    { 18, 10, 0x092, 0x007 },  // grid 1, col 2
+    { 18, 11, 0x124, 0x007 },  // grid 1, col 3
+    { 19, 12, 0x049, 0x007 },  // grid 2, col 4
+    { 19, 13, 0x092, 0x007 },  // grid 2, col 5
+    { 19, 14, 0x124, 0x007 },  // grid 2, col 6
+    { 20, 15, 0x049, 0x007 },  // grid 3, col 7
+    { 20, 16, 0x092, 0x007 },  // grid 3, col 8
+    { 20, 17, 0x124, 0x007 },  // grid 3, col 9
+    { 21,  9, 0x049, 0x038 },  // grid 4, col 1
+    { 21, 10, 0x092, 0x038 },  // grid 4, col 2
+    { 21, 11, 0x124, 0x038 },  // grid 4, col 3
+    { 22, 12, 0x049, 0x038 },  // grid 5, col 4
+    { 22, 13, 0x092, 0x038 },  // grid 5, col 5
+    { 22, 14, 0x124, 0x038 },  // grid 5, col 6
+    { 23, 15, 0x049, 0x038 },  // grid 6, col 7
+    { 23, 16, 0x092, 0x038 },  // grid 6, col 8
+    { 23, 17, 0x124, 0x038 },  // grid 6, col 9
+    { 24,  9, 0x049, 0x1C0 },  // grid 7, col 1
+    { 24, 10, 0x092, 0x1C0 },  // grid 7, col 2
+    { 24, 11, 0x124, 0x1C0 },  // grid 7, col 3
+    { 25, 12, 0x049, 0x1C0 },  // grid 8, col 4
+    { 25, 13, 0x092, 0x1C0 },  // grid 8, col 5
+    { 25, 14, 0x124, 0x1C0 },  // grid 8, col 6
+    { 26, 15, 0x049, 0x1C0 },  // grid 9, col 7
+    { 26, 16, 0x092, 0x1C0 },  // grid 9, col 8
+    { 26, 17, 0x124, 0x1C0 },  // grid 9, col 9
+};
+
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_locked_candidates(sudo_state_t *state, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                     // Results of execution
+    int total_elims = 0;                      // Number of candidates eliminated
+    const sudo_intersection_t *inter = NULL;  // Current intersection
+    uint16_t box_slots = 0;                   // The digit's slots in the grid
+    uint16_t line_slots = 0;                  // The digit's slots in the row or col
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        for (int i = 0; i < 54 && false == state->contradiction; i++)
+        {
+            inter = sudo_intersections + i;
+            for (int digit = 1; digit <= 9; digit++)
+            {
+                box_slots = state->unit_pos[inter->box_unit][digit - 1];
+                line_slots = state->unit_pos[inter->line_unit][digit - 1];
+                if (0 == box_slots || 0 == line_slots)
+                {
+                    continue;  // Placed in (or missing from) one of these units
+                }
+                // Pointing
+                if (0 == (box_slots & ~inter->box_mask) && (line_slots & ~inter->line_mask))
+                {
+                    total_elims += remove_sudo_slots(state, inter->line_unit,
+                                                     line_slots & ~inter->line_mask, digit);
+                }
+                // Claiming
+                else if (0 == (line_slots & ~inter->line_mask) && (box_slots & ~inter->box_mask))
+                {
+                    total_elims += remove_sudo_slots(state, inter->box_unit,
+                                                     box_slots & ~inter->box_mask, digit);
+                }
+            }
+        }
+        FPRINTF_ERR("%s Locked candidates eliminated %d candidates\n", DEBUG_INFO_STR,
+                    total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
@@ -6,10 +6,25 @@
 
 #include <errno.h>                          // EINVAL, ENODATA
 #include <stdbool.h>                        // bool, false, true
-#include <string.h>                         // memset()
+#include "sudo_bitboard.h"                  // solve_bitboard()
+#include "sudo_chains.h"                    // solve_chains()
 #include "sudo_debug.h"                     // MODULE_*LOAD(), PRINT_ERRNO(), PRINT_ERROR()
+#include "sudo_dlx.h"                       // find_dlx_solution()
+#include "sudo_fish.h"                      // solve_fish()
+#include "sudo_forcing.h"                   // solve_forcing()
+#include "sudo_kernel.h"                    // get_sudo_single(), is_full_sudo_board()
+#include "sudo_locked.h"                    // solve_locked_candidates()
+#include "sudo_logic.h"                     // sudo_options_t
 #include "sudo_macros.h"                    // ENOERR
+#include "sudo_profile.h"                   // profile_sudo_strategy()
+#include "sudo_sat.h"                       // solve_sat()
+#include "sudo_search.h"                    // count_search(), solve_search_restarts()
+#include "sudo_state.h"                     // sudo_state_t, init_sudo_state(), play_sudo_digit()
+#include "sudo_subsets.h"                   // solve_subsets()
+#include "sudo_template.h"                  // solve_templates()
+#include "sudo_uniqueness.h"                // solve_uniqueness()
 #include "sudo_validation.h"                // validate_board()
+#include "sudo_wings.h"                     // solve_wings()
 
 
 MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
@@ -22,173 +37,318 @@ MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destruct
 
 /*
  *  Description:
- *      STRATEGY 1: If ~[ROW SET] && ~[COL SET] && ~[GRID SET] is one value?
- *      This function (almost) does *NOT* validate anything!
+ *      Apply simple coloring and X-chains.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      row: The row index.
- *      col: The column index.
- *      errnum: [Out] Provide feedback on execution.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      The available play on success (errnum is set to ENOERR).  Nul character if no solution was
- *      found (errnum is set to ENODATA).  Nul character on error (errnum is set with errno).
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-char check_for_match(char board[9][9], int row, int col, int *errnum);
+int apply_chains(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Determine the grid containing the intersection of row and col.
- *      1 2 3
- *      4 5 6
- *      7 8 9
+ *      Apply fish up to options->fish_size (0 disables them).  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      row: The row index.
- *      col: The column index.
- *      errnum: [Out] Provide feedback on execution.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      A grid number 1-9 on success (errnum is set to ENOERR), 0 on error (errnum is set
- *      accordingly).
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int determine_grid(int row, int col, int *errnum);
+int apply_fish(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Fill the miss_col array with all the characters missing from board*[col].
+ *      Apply forcing chains within options->forcing_budget (0 disables them).  Matches
+ *      sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      miss_col: An array to fill with missing characters.
- *      col: The col index.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      ENOERR on success, errno value on error.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int fill_missing_col(char board[9][9], char miss_col[9], int col);
+int apply_forcing(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Fill the miss_grid array with all the characters missing from the 3x3 grid containing
- *      board[row][col].
+ *      Apply strategy two.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      miss_grid: An array to fill with missing characters.
- *      row: The row index.
- *      col: The col index.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      ENOERR on success, errno value on error.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int fill_missing_grid(char board[9][9], char miss_grid[9], int row, int col);
+int apply_hidden_singles(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Fill the miss_row array with all the characters missing from board[row]*.
+ *      Apply locked candidates.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      miss_row: An array to fill with missing characters.
- *      row: The row index.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      ENOERR on success, errno value on error.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int fill_missing_row(char board[9][9], char miss_row[9], int row);
+int apply_locked(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Determine if the intersection of row and col is empty.  This function does not validate
- *      the game board but does validate row and col.
+ *      Apply strategy one.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      row: The row index.
- *      col: The column index.
- *      errnum: [Out] Provide feedback on execution.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      Returns true if the intersection is empty, false otherwise.  On error, returns false and
- *      sets errnum with an errno value.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-bool is_empty_intersection(char board[9][9], int row, int col, int *errnum);
+int apply_naked_singles(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Is the game really over?  This function does not validate the game board.
+ *      Apply naked and hidden subsets.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      ENOERR on game over, ENODATA for an unsolved game board, or errno on error.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int is_game_really_over(char board[9][9]);
+int apply_subsets(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      STRATEGY 1: If ~[ROW SET] && ~[COL SET] && ~[GRID SET] is one value, solve it.
+ *      Apply template eliminations.  Matches sudo_strategy_fn_t.
  *
  *  Args:
- *      board: A two-dimenstional array.
- *      row: The row index.
- *      col: The column index.
- *      errnum: [Out] Provide feedback on execution.
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
  *
  *  Returns:
- *      ENOERR for a match, ENODATA if no match was made, or errno on error.
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
  */
-int make_a_match(char board[9][9], int row, int col);
+int apply_templates(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
 
 /*
  *  Description:
- *      Use strategy one to solve the board.  This function does not validate the game board.
+ *      Apply the uniqueness strategies if options->assume_unique is set.  Matches
+ *      sudo_strategy_fn_t.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
+ */
+int apply_uniqueness(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
+
+/*
+ *  Description:
+ *      Apply XY-Wings, XYZ-Wings, and W-Wings.  Matches sudo_strategy_fn_t.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      options: The solver options.
+ *      num_progress: [Optional Out] The number of plays made or candidates eliminated.
+ *
+ *  Returns:
+ *      ENOERR if progress was made, ENODATA if none was, or errno on error.
+ */
+int apply_wings(sudo_state_t *state, const sudo_options_t *options, int *num_progress);
+
+/*
+ *  Description:
+ *      Use strategy one to make progress on the board.  This function does not validate the
+ *      solver state.
+ *
+ *  Notes:
+ *      The solver state queues every empty intersection whose ~[ROW SET] && ~[COL SET] &&
+ *      ~[GRID SET] is one value.  Pop each one and solve it, which can only queue its peers.
+ *      Stop when the queue runs dry, the game is won, or a contradiction is found.
+ *
+ *  Args:
+ *      state: The solver state.
+ *
+ *  Returns:
+ *      ENOERR if at least one play was made, ENODATA if no play was made, or errno on error.
+ */
+int solve_strategy_one(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Use strategy two to make progress on the board.  This function does not validate the
+ *      solver state.
  *
  *  Notes:
- *      For each row and column that isn't solved at the intersection...
- *      If ~[ROW SET] && ~[COL SET] && ~[GRID SET] is one value, solve it.  Declare win or continue.
- *      If the loop ends, check for a win and return accordingly.
+ *      STRATEGY 2: If a digit has exactly one slot left in a row, col, or grid, solve it.
+ *      The solver state keeps a slot mask for every unit and digit and queues each one that
+ *      drops to a single slot, so this is a queue pop instead of a unit rescan.
  *
  *  Args:
- *      board: A fixed-size array of 81 characters.  Each character must be a SUDO_EMPTY_GRID
- *          or number ranging from 1-9, inclusive.
+ *      state: The solver state.
+ *
+ *  Returns:
+ *      ENOERR if at least one play was made, ENODATA if no play was made, or errno on error.
+ */
+int solve_strategy_two(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Solve a validated game board with the solver state: run the engine's strategy pipeline,
+ *      restarting from its first stage after any progress, then (optionally) search.  This
+ *      function does not validate its arguments.
+ *
+ *  Args:
+ *      board: [In/Out] A fixed-size array of 81 characters.  Progress is written back either way.
+ *      options: The solver options.
  *
  *  Returns:
  *      ENOERR on success, ENODATA for an unsolved game board, or errno on error.
  */
-int solve_strategy_one(char board[81]);
+int solve_with_strategies(char board[81], const sudo_options_t *options);
 
 /*
  *  Description:
- *      Validate row and col arguments for this module.
+ *      Validate solver options for this module.
  *
  *  Args:
- *      row: The row index.
- *      col: The column index.
+ *      options: The solver options.
  *
  *  Returns:
- *      ENOERR on success, ERANGE on error.
+ *      ENOERR on success, EINVAL on error.
  */
-int validate_row_and_col(int row, int col);
+int validate_options(const sudo_options_t *options);
+
+
+// The strategy registry
+const sudo_strategy_t sudo_strategies[SUDO_NUM_STRATEGIES] = {
+    [SUDO_STRATEGY_NAKED_SINGLE] = { "Naked Single", SUDO_COST_TRIVIAL, apply_naked_singles },
+    [SUDO_STRATEGY_HIDDEN_SINGLE] = { "Hidden Single", SUDO_COST_TRIVIAL, apply_hidden_singles },
+    [SUDO_STRATEGY_LOCKED] = { "Locked Candidates", SUDO_COST_LOW, apply_locked },
+    [SUDO_STRATEGY_SUBSETS] = { "Subsets", SUDO_COST_MEDIUM, apply_subsets },
+    [SUDO_STRATEGY_FISH] = { "Fish", SUDO_COST_MEDIUM, apply_fish },
+    [SUDO_STRATEGY_WINGS] = { "Wings", SUDO_COST_MEDIUM, apply_wings },
+    [SUDO_STRATEGY_CHAINS] = { "Chains", SUDO_COST_HIGH, apply_chains },
+    [SUDO_STRATEGY_UNIQUENESS] = { "Uniqueness", SUDO_COST_HIGH, apply_uniqueness },
+    [SUDO_STRATEGY_FORCING] = { "Forcing Chains", SUDO_COST_EXTREME, apply_forcing },
+    [SUDO_STRATEGY_TEMPLATE] = { "Templates", SUDO_COST_EXTREME, apply_templates },
+};
+
+// The template engine's pipeline
+const sudo_strategy_id_t sudo_template_order[] = {
+    SUDO_STRATEGY_NAKED_SINGLE, SUDO_STRATEGY_HIDDEN_SINGLE, SUDO_STRATEGY_TEMPLATE
+};
+
 
 /**************************************************************************************************/
 /********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
 /**************************************************************************************************/
 
 
+int count_solutions(const char board[81], int limit, int *num_solutions, char witnesses[][81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    sudo_state_t state;    // Candidate masks for board
+
+    // INPUT VALIDATION
+    if (limit < 1 || NULL == num_solutions)
+    {
+        results = EINVAL;  // Bad input
+    }
+    else
+    {
+        results = validate_board(board);  // Full validation
+    }
+
+    // COUNT THEM
+    if (ENOERR == results)
+    {
+        results = init_sudo_state(&state, board);
+    }
+    if (ENOERR == results)
+    {
+        results = count_search(&state, limit, num_solutions, witnesses);
+    }
+
+    // DONE
+    return results;
+}
+
+
+int init_sudo_options(sudo_options_t *options)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == options)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // DEFAULTS
+    if (ENOERR == results)
+    {
+        options->engine = SUDO_ENGINE_LOGIC;
+        options->fish_size = SUDO_MAX_FISH;
+        options->forcing_budget = SUDO_FORCING_BUDGET;
+        options->assume_unique = false;
+        options->search = true;
+        options->restart = SUDO_RESTART_NONE;
+        options->restart_base = SUDO_RESTART_BASE;
+        options->seed = 0;
+        options->num_strategies = 0;
+        for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+        {
+            if (SUDO_STRATEGY_TEMPLATE != id)
+            {
+                options->order[options->num_strategies++] = id;
+            }
+        }
+        options->max_cost = SUDO_COST_EXTREME;
+        options->profile = NULL;
+        options->chain_counters = NULL;
+        options->ttable = NULL;
+        options->search_nodes = NULL;
+        options->sat_max_learned = 0;
+    }
+
+    // DONE
+    return results;
+}
+
+
 int is_game_over(char board[81])
 {
     // LOCAL VARIABLES
-    int results = validate_board(board);   // Input validation
-    char (*game)[9] = (char (*)[9])board;  // Cast it to a two-dimensional array
+    int results = validate_board(board);  // Input validation
 
     // IS IT OVER?
-    if (ENOERR == results)
+    if (ENOERR == results && false == is_full_sudo_board(board))
     {
-        results = is_game_really_over(game);
+        results = ENODATA;  // There's an empty grid
     }
 
     // DONE
@@ -197,11 +357,28 @@ int is_game_over(char board[81])
 
 
 int solve_board(char board[81])
+{
+    return solve_board_opts(board, NULL);
+}
+
+
+int solve_board_opts(char board[81], const sudo_options_t *options)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;  // Results of execution
+    int results = ENOERR;       // Results of execution
+    sudo_options_t defaults;    // Used when options is NULL
 
     // INPUT VALIDATION
+    if (NULL == options)
+    {
+        init_sudo_options(&defaults);
+        options = &defaults;
+    }
+    results = validate_options(options);
+    if (ENOERR != results)
+    {
+        goto done;  // Bad options
+    }
     results = is_game_over(board);  // Full validation
     // Respond to results
     if (ENOERR == results)
@@ -216,11 +393,20 @@ int solve_board(char board[81])
     // SOLVE IT
     if (ENOERR == results)
     {
-        // Strategy #1
-        results = solve_strategy_one(board);
-        if (ENODATA == results)
+        switch (options->engine)
         {
-            PRINT_ERROR(Strategy number one failed to solve the game);
+            case SUDO_ENGINE_DLX:
+                results = find_dlx_solution(board);
+                break;
+            case SUDO_ENGINE_SAT:
+                results = solve_sat(board, options->sat_max_learned, NULL);
+                break;
+            case SUDO_ENGINE_BITBOARD:
+                results = solve_bitboard(board, NULL);
+                break;
+            default:
+                results = solve_with_strategies(board, options);
+                break;
         }
     }
 
@@ -245,272 +431,119 @@ done:
 /**************************************************************************************************/
 
 
-char check_for_match(char board[9][9], int row, int col, int *errnum)
+int apply_chains(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
-    // LOCAL VARIABLES
-    int results = ENOERR;         // Results of execution
-    char miss_row[9] = { '\0' };  // Characters missing from the row
-    char miss_col[9] = { '\0' };  // Characters missing from the col
-    char miss_grd[9] = { '\0' };  // Characters missing from the grid
-    char overlap = '\0';          // Overlap character between all three arrays
+    return solve_chains(state, options->chain_counters, num_progress);
+}
 
-    // INPUT VALIDATION
-    if (NULL == board)
-    {
-        results = EINVAL;  // We shall not abide NULL pointers
-    }
 
-    // CHECK IT
-    // Get missing row characters
-    if (ENOERR == results)
-    {
-        results = fill_missing_row(board, miss_row, row);
-    }
-    // Get missing col characters
-    if (ENOERR == results)
-    {
-        results = fill_missing_col(board, miss_col, col);
-    }
-    // Get missing grid characters
-    if (ENOERR == results)
+int apply_fish(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
+{
+    // LOCAL VARIABLES
+    int results = ENODATA;  // Results of execution
+
+    // SOLVE IT
+    if (options->fish_size > 0)
     {
-        results = fill_missing_grid(board, miss_grd, row, col);
+        results = solve_fish(state, options->fish_size, num_progress);
     }
-    // Find overlap
-    if (ENOERR == results)
+    else if (NULL != num_progress)
     {
-        results = ENODATA;  // Now using this variable to keep track of multiple solutions
-        for (int row_index = 0; row_index < 9; row_index++)
-        {
-            if ('\0' == miss_row[row_index])
-            {
-                break;  // End of line
-            }
-            for (int col_index = 0; col_index < 9; col_index++)
-            {
-                if ('\0' == miss_col[col_index])
-                {
-                    break;  // End of line
-                }
-                else if (miss_row[row_index] != miss_col[col_index])
-                {
-                    continue;  // Not a match... keep looking
-                }
-                for (int grid_index = 0; grid_index < 9; grid_index++)
-                {
-                    if ('\0' == miss_grd[grid_index])
-                    {
-                        break;  // End of line
-                    }
-                    else if (miss_col[col_index] != miss_grd[grid_index])
-                    {
-                        continue;  // Not a match... keep looking
-                    }
-                    else
-                    {
-                        if (ENOERR == results)
-                        {
-                            results = ENODATA;  // A second solution was found so...
-                            overlap = '\0';     // ...this is not the answer.
-                            goto done;          // Time to stop looking.
-                        }
-                        else
-                        {
-                            overlap = miss_grd[grid_index];  // Found one!
-                            results = ENOERR;  // Success
-                        }
-                    }
-                }
-            }
-        }
+        *num_progress = 0;  // Disabled
     }
 
     // DONE
-done:
-    if (NULL != errnum)
-    {
-        *errnum = results;
-    }
-    return overlap;
+    return results;
 }
 
 
-int determine_grid(int row, int col, int *errnum)
+int apply_forcing(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;  // Results of execution
-    int grid_num = 0;      // 1-9 on success
+    int results = ENODATA;  // Results of execution
 
-    // INPUT VALIDATION
-    results = validate_row_and_col(row, col);
-
-    // DETERMINE IT
-    if (ENOERR == results)
+    // SOLVE IT
+    if (options->forcing_budget > 0)
     {
-        switch (row)
-        {
-            case 0:
-            case 1:
-            case 2:
-                grid_num = (col + 3) / 3;
-                break;
-            case 3:
-            case 4:
-            case 5:
-                grid_num = ((col + 3) / 3) + 3;
-                break;
-            case 6:
-            case 7:
-            case 8:
-                grid_num = ((col + 3) / 3) + 6;
-                break;
-            default:
-                results = EINVAL;  // How did we get here?!
-        }
+        results = solve_forcing(state, options->forcing_budget, num_progress);
     }
-
-    // DONE
-    if (NULL != errnum)
+    else if (NULL != num_progress)
     {
-        *errnum = results;
+        *num_progress = 0;  // Disabled
     }
-    return grid_num;
+
+    // DONE
+    return results;
 }
 
 
-int fill_missing_col(char board[9][9], char miss_col[9], int col)
+int apply_hidden_singles(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;           // Results of execution
-    int found[10] = { 0 };          // Keep track of chars found by index (index 1 represents '1')
-    char *tmp_miss_col = miss_col;  // Iterating pointer into miss_col
+    int num_empty = state->num_empty;  // Empty cells before the strategy
+    int results = ENOERR;              // Results of execution
 
-    // INPUT VALIDATION
-    if (NULL == board || NULL == miss_col)
-    {
-        results = EINVAL;  // We shall not abide NULL pointers
-    }
+    // SOLVE IT
+    results = solve_strategy_two(state);
 
-    // SETUP
-    if (ENOERR == results)
+    // DONE
+    if (NULL != num_progress)
     {
-        memset(miss_col, '\0', 9 * sizeof(char));
+        *num_progress = num_empty - state->num_empty;
     }
+    return results;
+}
 
-    // FILL IT
-    if (ENOERR == results)
-    {
-        for (int i = 0; i < 9; i++)
-        {
-            if (SUDO_EMPTY_GRID != board[i][col])
-            {
-                found[board[i][col] - '0'] = 1;  // Found one
-            }
-        }
-        for (int i = 1; i <= 9; i++)
-        {
-            if (0 == found[i])
-            {
-                *tmp_miss_col = i + '0';
-                tmp_miss_col++;
-            }
-        }
-    }
 
-    // DONE
-    return results;
+int apply_locked(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
+{
+    return solve_locked_candidates(state, num_progress);
 }
 
 
-int fill_missing_grid(char board[9][9], char miss_grid[9], int row, int col)
+int apply_naked_singles(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;             // Results of execution
-    int found[10] = { 0 };            // Keep track of chars found by index (index 1 represents '1')
-    char *tmp_miss_grid = miss_grid;  // Iterating pointer into miss_col
-    int grid_num = 0;                 // Grid number containing row and col
-    int start_row = 0;                // Iterate over the grid's rows
-    int start_col = 0;                // Iterate over the grid's cols
+    int num_empty = state->num_empty;  // Empty cells before the strategy
+    int results = ENOERR;              // Results of execution
 
-    // INPUT VALIDATION
-    if (NULL == board || NULL == miss_grid)
-    {
-        results = EINVAL;  // We shall not abide NULL pointers
-    }
+    // SOLVE IT
+    results = solve_strategy_one(state);
 
-    // FILL IT
-    // Determine which grid row and col is in
-    if (ENOERR == results)
-    {
-        grid_num = determine_grid(row, col, &results);
-    }
-    // Get the values from that grid
-    if (ENOERR == results)
+    // DONE
+    if (NULL != num_progress)
     {
-        start_row = 3 * ((grid_num - 1) / 3);
-        start_col = 3 * ((grid_num - 1) % 3);
-        for (int i = 0; i < 3; i++)
-        {
-            for (int j = 0; j < 3; j++)
-            {
-                if (SUDO_EMPTY_GRID != board[start_row + i][start_col + j])
-                {
-                    found[board[start_row + i][start_col + j] - '0'] = 1;  // Found one
-                }
-            }
-        }
-        for (int i = 1; i <= 9; i++)
-        {
-            if (0 == found[i])
-            {
-                *tmp_miss_grid = i + '0';
-                tmp_miss_grid++;
-            }
-        }
+        *num_progress = num_empty - state->num_empty;
     }
-
-    // DONE
     return results;
 }
 
 
-int fill_missing_row(char board[9][9], char miss_row[9], int row)
+int apply_subsets(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
+{
+    return solve_subsets(state, num_progress);
+}
+
+
+int apply_templates(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
+{
+    return solve_templates(state, num_progress);
+}
+
+
+int apply_uniqueness(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;           // Results of execution
-    int found[10] = { 0 };          // Keep track of chars found by index (index 1 represents '1')
-    char *tmp_miss_row = miss_row;  // Iterating pointer into miss_row
+    int results = ENODATA;  // Results of execution
 
-    // INPUT VALIDATION
-    if (NULL == board || NULL == miss_row)
+    // SOLVE IT
+    if (true == options->assume_unique)
     {
-        results = EINVAL;  // We shall not abide NULL pointers
+        results = solve_uniqueness(state, num_progress);
     }
-
-    // SETUP
-    if (ENOERR == results)
+    else if (NULL != num_progress)
     {
-        memset(miss_row, '\0', 9 * sizeof(char));
-    }
-
-    // FILL IT
-    if (ENOERR == results)
-    {
-        for (int i = 0; i < 9; i++)
-        {
-            if (SUDO_EMPTY_GRID != board[row][i])
-            {
-                found[board[row][i] - '0'] = 1;  // Found one
-            }
-        }
-        for (int i = 1; i <= 9; i++)
-        {
-            if (0 == found[i])
-            {
-                *tmp_miss_row = i + '0';
-                tmp_miss_row++;
-            }
-        }
+        *num_progress = 0;  // Only sound for unique boards
     }
 
     // DONE
@@ -518,161 +551,234 @@ int fill_missing_row(char board[9][9], char miss_row[9], int row)
 }
 
 
-bool is_empty_intersection(char board[9][9], int row, int col, int *errnum)
+int apply_wings(sudo_state_t *state, const sudo_options_t *options, int *num_progress)
 {
-    // LOCAL VARIABLES
-    int results = ENOERR;   // Results of execution
-    bool is_empty = false;  // Is row && col empty?
-
-    // INPUT VALIDATION
-    results = validate_row_and_col(row, col);
-
-    // IS IT EMPTY?
-    if (ENOERR == results)
-    {
-        if (SUDO_EMPTY_GRID == board[row][col])
-        {
-            is_empty = true;
-        }
-    }
-
-    // DONE
-    if (NULL != errnum)
-    {
-        *errnum = results;
-    }
-    return is_empty;
+    return solve_wings(state, num_progress);
 }
 
 
-int is_game_really_over(char board[9][9])
+int solve_strategy_one(sudo_state_t *state)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;  // Results of execution
+    int cell = 0;          // Queued cell to solve
+    int digit = 0;         // The only candidate left for cell
+    int num_plays = 0;     // Number of plays made
 
-    // IS IT REALLY OVER?
-    for (int row = 0; row < 9; row++)
+    // SOLVE IT
+    while (state->num_empty > 0 && false == state->contradiction)
     {
-        for (int col = 0; col < 9; col++)
+        cell = next_sudo_single(state);
+        if (cell < 0)
         {
-            if (SUDO_EMPTY_GRID == board[row][col])
-            {
-                results = ENODATA;  // There's an empty grid
-                goto done;  // No need to search for anymore empty grids
-            }
+            break;  // No plays to make
+        }
+        digit = get_sudo_single(state, cell);
+        if (0 != digit)
+        {
+            play_sudo_digit(state, cell, digit);
+            num_plays++;
         }
     }
 
     // DONE
-done:
-    return results;
+    return (num_plays > 0) ? ENOERR : ENODATA;
 }
 
 
-int make_a_match(char board[9][9], int row, int col)
+int solve_strategy_two(sudo_state_t *state)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;   // Results of execution
-    bool is_empty = false;  // Is the intersection of row and col empty
-    char match = '\0';      // Match to be made
+    int cell = 0;          // Queued cell to solve
+    int digit = 0;         // Digit that belongs in cell
+    int num_plays = 0;     // Number of plays made
 
-    // VALIDATION
-    is_empty = is_empty_intersection(board, row, col, &results);
-    if (true == is_empty)
+    // SOLVE IT
+    while (state->num_empty > 0 && false == state->contradiction)
     {
-        match = check_for_match(board, row, col, &results);
-        if ('\0' != match && ENOERR == results)
+        cell = next_sudo_hidden(state, &digit);
+        if (cell < 0)
         {
-            board[row][col] = match;
+            break;  // No plays to make
         }
-    }
-    else if (ENOERR == results)
-    {
-        results = ENODATA;  // No error and intersection wasn't empty
+        play_sudo_digit(state, cell, digit);  // Queued, so a legal play
+        num_plays++;
     }
 
     // DONE
-    return results;
+    return (num_plays > 0) ? ENOERR : ENODATA;
 }
 
 
-int solve_strategy_one(char board[81])
+int solve_with_strategies(char board[81], const sudo_options_t *options)
 {
     // LOCAL VARIABLES
-    int results = ENODATA;                 // Results of execution
-    char (*game)[9] = (char (*)[9])board;  // Cast it to a two-dimensional array
+    int results = ENOERR;                            // Results of execution
+    sudo_state_t state;                              // Candidate masks for board
+    const sudo_strategy_id_t *order = options->order;  // Pipeline to run
+    int num_stages = options->num_strategies;        // Number of stages in order
+    int stage = 0;                                   // Index of the current stage
+    const sudo_strategy_t *strategy = NULL;          // Strategy for the current stage
+    uint64_t num_nodes = 0;                          // Search nodes visited
+
+    // SETUP
+    results = init_sudo_state(&state, board);
+    if (SUDO_ENGINE_TEMPLATE == options->engine)
+    {
+        order = sudo_template_order;
+        num_stages = sizeof(sudo_template_order) / sizeof(sudo_template_order[0]);
+    }
 
     // SOLVE IT
-    do
+    while (ENOERR == results && state.num_empty > 0 && false == state.contradiction)
     {
-        for (int row = 0; row < 9; row++)
+        if (stage >= num_stages)
         {
-            for (int col = 0; col < 9; col++)
-            {
-                results = make_a_match(game, row, col);
-                if (ENODATA != results)
-                {
-                    break;  // Break out of the for loops
-                }
-            }
-            if (ENODATA != results)
-            {
-                break;  // Break out of the for loops
-            }
+            results = ENODATA;  // Every stage stalled
+            break;
         }
-        // Respond to results
-        if (ENOERR == results)  // Made a play
+        strategy = sudo_strategies + order[stage];
+        if (strategy->cost > options->max_cost)
         {
-            results = is_game_really_over(game);  // Is it over yet?
-            if (ENODATA == results)
-            {
-                continue;  // Game's not over yet
-            }
-            else if (ENOERR == results)
-            {
-                break;  // Game over man!
-            }
-            else
-            {
-                PRINT_ERROR(is_game_really_over identified an error);
-                break;  // Encountered an error
-            }
+            stage++;  // Too expensive
+            continue;
         }
-        else if (ENODATA == results)  // Made a full loop without a play
+        if (NULL == options->profile)
         {
-            PRINT_ERROR(Strategy one failed to make a play);
-            break;  // No plays to make
+            results = strategy->apply(&state, options, NULL);
+        }
+        else
+        {
+            results = profile_sudo_strategy(options->profile, order[stage], &state, options, NULL);
+        }
+        if (ENOERR == results)
+        {
+            stage = 0;  // Progress: start over from the cheapest stage
+        }
+        else if (ENODATA == results)
+        {
+            results = ENOERR;  // Escalate
+            stage++;
         }
-        else if (ENOERR != results)
+    }
+    // Search when the strategies stall
+    if (ENODATA == results && true == options->search && false == state.contradiction)
+    {
+        results = solve_search_restarts(&state, options->restart, options->restart_base,
+                                        options->seed, options->ttable, &num_nodes);
+        if (NULL != options->search_nodes)
+        {
+            *options->search_nodes += num_nodes;
+        }
+        if (ENODATA == results)
         {
-            PRINT_ERROR(Encountered an error in strategy one);
-            break;  // Encountered an error
+            state.contradiction = true;  // The search proved there is no solution
         }
     }
-    while (1);
+    // Respond to results
+    if (ENOERR == results || ENODATA == results)
+    {
+        if (true == state.contradiction)
+        {
+            PRINT_ERROR(The strategies found a contradiction);
+            results = ENODATA;  // This board has no solution
+        }
+        else if (state.num_empty > 0)
+        {
+            PRINT_ERROR(The strategies failed to solve the game);
+            results = ENODATA;  // Out of plays
+        }
+        export_sudo_state(&state, board);  // Return our progress either way
+    }
 
     // DONE
     return results;
 }
 
 
-int validate_row_and_col(int row, int col)
+int validate_options(const sudo_options_t *options)
 {
     // LOCAL VARIABLES
-    int results = ENOERR;   // Results of execution
+    int results = ENOERR;  // Results of execution
 
     // INPUT VALIDATION
-    // row
-    if (row > 8 || row < 0)
+    if (NULL == options)
     {
-        results = ERANGE;  // Row is out of range
-        FPRINTF_ERR("%s The row %d is out of index\n", DEBUG_ERROR_STR, row);
+        results = EINVAL;  // We shall not abide NULL pointers
     }
-    // col
-    if (col > 8 || col < 0)
+    // engine
+    else if (options->engine < SUDO_ENGINE_LOGIC || options->engine > SUDO_ENGINE_BITBOARD)
     {
-        results = ERANGE;  // Column is out of range
-        FPRINTF_ERR("%s The column %d is out of index\n", DEBUG_ERROR_STR, col);
+        results = EINVAL;  // Unknown engine
+        FPRINTF_ERR("%s The engine %d is not supported\n", DEBUG_ERROR_STR, options->engine);
+    }
+    // fish_size
+    else if (0 != options->fish_size
+             && (options->fish_size < 2 || options->fish_size > SUDO_MAX_FISH))
+    {
+        results = EINVAL;  // Unsupported fish
+        FPRINTF_ERR("%s The fish size %d is not supported\n", DEBUG_ERROR_STR, options->fish_size);
+    }
+    // forcing_budget
+    else if (options->forcing_budget < 0)
+    {
+        results = EINVAL;  // Negative budget
+        FPRINTF_ERR("%s The forcing budget %d is negative\n", DEBUG_ERROR_STR,
+                    options->forcing_budget);
+    }
+    // restart
+    else if (options->restart < SUDO_RESTART_NONE || options->restart > SUDO_RESTART_GEOMETRIC)
+    {
+        results = EINVAL;  // Unknown schedule
+        FPRINTF_ERR("%s The restart schedule %d is not supported\n", DEBUG_ERROR_STR,
+                    options->restart);
+    }
+    // restart_base
+    else if (options->restart_base < 1)
+    {
+        results = EINVAL;  // Runs must be allowed to visit a node
+        FPRINTF_ERR("%s The restart base %d is not positive\n", DEBUG_ERROR_STR,
+                    options->restart_base);
+    }
+    // ttable
+    else if (NULL != options->ttable && NULL == options->ttable->slots)
+    {
+        results = EINVAL;  // Never created (or already destroyed)
+        FPRINTF_ERR("%s The transposition table has no slots\n", DEBUG_ERROR_STR);
+    }
+    // sat_max_learned
+    else if (options->sat_max_learned < 0)
+    {
+        results = EINVAL;  // Negative budget
+        FPRINTF_ERR("%s The learned clause budget %d is negative\n", DEBUG_ERROR_STR,
+                    options->sat_max_learned);
+    }
+    // num_strategies
+    else if (options->num_strategies < 0 || options->num_strategies > SUDO_NUM_STRATEGIES)
+    {
+        results = EINVAL;  // Doesn't fit in order
+        FPRINTF_ERR("%s The strategy count %d is out of range\n", DEBUG_ERROR_STR,
+                    options->num_strategies);
+    }
+    // max_cost
+    else if (options->max_cost < SUDO_COST_TRIVIAL || options->max_cost > SUDO_COST_EXTREME)
+    {
+        results = EINVAL;  // Unknown cost class
+        FPRINTF_ERR("%s The cost class %d is not supported\n", DEBUG_ERROR_STR,
+                    options->max_cost);
+    }
+    // order
+    else
+    {
+        for (int i = 0; i < options->num_strategies; i++)
+        {
+            if (options->order[i] < 0 || options->order[i] >= SUDO_NUM_STRATEGIES)
+            {
+                results = EINVAL;  // Unknown strategy
+                FPRINTF_ERR("%s The strategy %d is not supported\n", DEBUG_ERROR_STR,
+                            options->order[i]);
+                break;
+            }
+        }
     }
 
     // DONE
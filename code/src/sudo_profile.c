@@ -0,0 +1,318 @@
+/*
+ *  This library defines per-strategy statistics and adaptive strategy ordering on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, EIO, errno
+#include <inttypes.h>                       // PRIu64, SCNu64
+#include <stdbool.h>                        // bool, false, true
+#include <stdio.h>                          // fopen(), fgets(), fprintf(), sscanf(), fclose()
+#include <string.h>                         // memset(), strlen(), strncmp()
+#include <time.h>                           // clock_gettime()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR(), PRINT_ERRNO()
+#include "sudo_macros.h"                    // ENOERR
+#include "sudo_profile.h"                   // sudo_profile_t
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/* PROFILE MACROS */
+// SUDO_PROFILE_HEADER
+#define SUDO_PROFILE_HEADER "sudo_profile 1"  // First line of a profile file, with its version
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Read the monotonic clock.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      The time in nanoseconds.
+ */
+uint64_t get_profile_ns(void);
+
+/*
+ *  Description:
+ *      Is the strategy's progress per nanosecond better than the other strategy's?  Compared by
+ *      cross-multiplying so neither rate is rounded.
+ *
+ *  Args:
+ *      stats: The strategy's statistics.
+ *      other: The other strategy's statistics.
+ *
+ *  Returns:
+ *      True if stats has the better rate.
+ */
+bool is_better_rate(const sudo_strategy_stats_t *stats, const sudo_strategy_stats_t *other);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int adapt_sudo_options(const sudo_profile_t *profile, sudo_options_t *options)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                             // Results of execution
+    sudo_strategy_id_t ranked[SUDO_NUM_STRATEGIES];   // Trusted strategies, best rate first
+    int num_ranked = 0;                               // Number of entries in ranked
+    sudo_strategy_id_t untried[SUDO_NUM_STRATEGIES];  // Strategies without enough calls
+    int num_untried = 0;                              // Number of entries in untried
+    const sudo_strategy_stats_t *stats = NULL;        // Statistics for a strategy
+    int index = 0;                                    // Insertion index in ranked
+
+    // INPUT VALIDATION
+    if (NULL == profile || NULL == options || options->num_strategies < 0
+        || options->num_strategies > SUDO_NUM_STRATEGIES)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // RANK THEM
+    if (ENOERR == results)
+    {
+        for (int i = 0; i < options->num_strategies; i++)
+        {
+            stats = profile->stats + options->order[i];
+            if (stats->calls < SUDO_PROFILE_MIN_CALLS)
+            {
+                untried[num_untried++] = options->order[i];
+            }
+            else if (stats->hits > 0)
+            {
+                // Insertion sort: ties keep their order
+                for (index = num_ranked; index > 0; index--)
+                {
+                    if (false == is_better_rate(stats, profile->stats + ranked[index - 1]))
+                    {
+                        break;
+                    }
+                    ranked[index] = ranked[index - 1];
+                }
+                ranked[index] = options->order[i];
+                num_ranked++;
+            }
+            else
+            {
+                FPRINTF_ERR("%s Dropping the %s strategy\n", DEBUG_INFO_STR,
+                            sudo_strategies[options->order[i]].name);
+            }
+        }
+        options->num_strategies = 0;
+        for (int i = 0; i < num_ranked; i++)
+        {
+            options->order[options->num_strategies++] = ranked[i];
+        }
+        for (int i = 0; i < num_untried; i++)
+        {
+            options->order[options->num_strategies++] = untried[i];
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+int init_sudo_profile(sudo_profile_t *profile)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == profile)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ZERO IT
+    if (ENOERR == results)
+    {
+        memset(profile, 0, sizeof(*profile));
+    }
+
+    // DONE
+    return results;
+}
+
+
+int load_sudo_profile(sudo_profile_t *profile, const char *filename)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;          // Results of execution
+    FILE *file = NULL;             // The profile file
+    char line[128] = { 0 };        // One line of the file
+    int id = 0;                    // Strategy id read from a line
+    sudo_strategy_stats_t stats;   // Statistics read from a line
+
+    // INPUT VALIDATION
+    if (NULL == profile || NULL == filename)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // OPEN IT
+    if (ENOERR == results)
+    {
+        file = fopen(filename, "r");
+        if (NULL == file)
+        {
+            results = errno;
+            PRINT_ERRNO(results);
+        }
+    }
+
+    // READ IT
+    if (ENOERR == results)
+    {
+        init_sudo_profile(profile);
+        if (NULL == fgets(line, sizeof(line), file)
+            || 0 != strncmp(line, SUDO_PROFILE_HEADER, strlen(SUDO_PROFILE_HEADER)))
+        {
+            results = EINVAL;  // Not a profile
+            FPRINTF_ERR("%s %s is not a SUDO profile\n", DEBUG_ERROR_STR, filename);
+        }
+        while (ENOERR == results && NULL != fgets(line, sizeof(line), file))
+        {
+            if (5 != sscanf(line, "%d %" SCNu64 " %" SCNu64 " %" SCNu64 " %" SCNu64, &id,
+                            &stats.calls, &stats.hits, &stats.progress, &stats.ns))
+            {
+                results = EINVAL;  // Malformed line
+                FPRINTF_ERR("%s Malformed profile line: %s", DEBUG_ERROR_STR, line);
+            }
+            else if (id >= 0 && id < SUDO_NUM_STRATEGIES)
+            {
+                profile->stats[id] = stats;
+            }
+        }
+    }
+
+    // DONE
+    if (NULL != file)
+    {
+        fclose(file);
+    }
+    return results;
+}
+
+
+int profile_sudo_strategy(sudo_profile_t *profile, sudo_strategy_id_t id, sudo_state_t *state,
+                          const sudo_options_t *options, int *num_progress)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                       // Results of execution
+    int progress = 0;                           // Progress the strategy made
+    uint64_t start = 0;                         // Time the strategy started
+    sudo_strategy_stats_t *stats = NULL;        // Statistics to update
+
+    // INPUT VALIDATION
+    if (NULL == profile || NULL == state || NULL == options || id < 0
+        || id >= SUDO_NUM_STRATEGIES)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // APPLY IT
+    if (ENOERR == results)
+    {
+        stats = profile->stats + id;
+        start = get_profile_ns();
+        results = sudo_strategies[id].apply(state, options, &progress);
+        stats->ns += get_profile_ns() - start;
+        stats->calls++;
+        if (ENOERR == results)
+        {
+            stats->hits++;
+            stats->progress += progress;
+        }
+    }
+
+    // DONE
+    if (NULL != num_progress)
+    {
+        *num_progress = progress;
+    }
+    return results;
+}
+
+
+int save_sudo_profile(const sudo_profile_t *profile, const char *filename)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                       // Results of execution
+    FILE *file = NULL;                          // The profile file
+    const sudo_strategy_stats_t *stats = NULL;  // Statistics to write
+
+    // INPUT VALIDATION
+    if (NULL == profile || NULL == filename)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // OPEN IT
+    if (ENOERR == results)
+    {
+        file = fopen(filename, "w");
+        if (NULL == file)
+        {
+            results = errno;
+            PRINT_ERRNO(results);
+        }
+    }
+
+    // WRITE IT
+    if (ENOERR == results)
+    {
+        fprintf(file, "%s\n", SUDO_PROFILE_HEADER);
+        for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+        {
+            stats = profile->stats + id;
+            fprintf(file, "%d %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %s\n", id,
+                    stats->calls, stats->hits, stats->progress, stats->ns,
+                    sudo_strategies[id].name);
+        }
+        if (0 != fclose(file))
+        {
+            results = EIO;  // The data didn't make it to the file
+        }
+        file = NULL;
+    }
+
+    // DONE
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+uint64_t get_profile_ns(void)
+{
+    // LOCAL VARIABLES
+    struct timespec now = { 0 };  // The current time
+
+    // READ IT
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // DONE
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+
+bool is_better_rate(const sudo_strategy_stats_t *stats, const sudo_strategy_stats_t *other)
+{
+    // progress / ns > other progress / other ns (a strategy too fast to time counts as 1 ns)
+    return (__uint128_t)stats->progress * (other->ns ? other->ns : 1)
+           > (__uint128_t)other->progress * (stats->ns ? stats->ns : 1);
+}
@@ -0,0 +1,804 @@
+/*
+ *  This library defines a conflict-driven clause learning (CDCL) SAT backend on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdbool.h>                        // bool, false, true
+#include <stdint.h>                         // int8_t
+#include <string.h>                         // memset()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "sudo_sat.h"                       // solve_sat()
+#include "sudo_validation.h"                // validate_board()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/* SAT MACROS */
+// SUDO_SAT_CELL_VARS
+#define SUDO_SAT_CELL_VARS 729  // One per cell and digit: (cell * 9) + (digit - 1)
+// SUDO_SAT_GROUPS
+#define SUDO_SAT_GROUPS 324  // Exactly-one groups: cells, then row/digit, col/digit, grid/digit
+// SUDO_SAT_VARS
+#define SUDO_SAT_VARS (SUDO_SAT_CELL_VARS + (SUDO_SAT_GROUPS * 8))  // Plus 8 counters per group
+// SUDO_SAT_LITS
+#define SUDO_SAT_LITS (SUDO_SAT_VARS * 2)  // Literal 2v is variable v, 2v + 1 is its negation
+// SUDO_SAT_MAX_CLAUSES, SUDO_SAT_MAX_LITS
+#define SUDO_SAT_MAX_CLAUSES 65536     // Room for the encoding plus learned clauses
+#define SUDO_SAT_MAX_LITS (1 << 20)    // Room for the literals of those clauses
+// SUDO_SAT_RESTART_BASE
+#define SUDO_SAT_RESTART_BASE 64  // Conflicts per unit of the Luby restart sequence
+// SUDO_SAT_DECAY
+#define SUDO_SAT_DECAY 0.95  // Activity decay per conflict
+// SUDO_SAT_UNASSIGNED
+#define SUDO_SAT_UNASSIGNED ((int8_t)-1)  // Value of an unassigned variable
+// SUDO_SAT_NO_REASON
+#define SUDO_SAT_NO_REASON -1  // Reason for decisions and level zero assignments
+
+/*
+ *  The solver.  Clause literals live in one arena.  The two watched literals of each clause are
+ *  its first two literals and each literal's watchers form a linked list threaded through the
+ *  clauses, so propagation never allocates.
+ */
+typedef struct
+{
+    int lits[SUDO_SAT_MAX_LITS];                // Literal arena
+    int num_lits;                               // Literals in use
+    int clause_start[SUDO_SAT_MAX_CLAUSES];     // Arena index of each clause's first literal
+    int clause_size[SUDO_SAT_MAX_CLAUSES];      // Number of literals in each clause
+    int watch_next[SUDO_SAT_MAX_CLAUSES][2];    // Next watcher of each clause's watched literals
+    int num_clauses;                            // Clauses in use
+    int num_encoded;                            // Clauses from the encoding (the rest are learned)
+    int num_encoded_lits;                       // Literals from the encoding
+    int max_clauses;                            // Clauses the current solve may use
+    int watch_head[SUDO_SAT_LITS];              // First clause watching each literal
+    int8_t value[SUDO_SAT_VARS];                // 0, 1, or SUDO_SAT_UNASSIGNED
+    int level[SUDO_SAT_VARS];                   // Decision level of each assignment
+    int reason[SUDO_SAT_VARS];                  // Clause that implied each assignment
+    bool phase[SUDO_SAT_VARS];                  // Last value of each variable
+    bool seen[SUDO_SAT_VARS];                   // Scratch space for conflict analysis
+    double activity[SUDO_SAT_VARS];             // Conflict activity of each variable
+    double var_inc;                             // Current activity bump
+    int trail[SUDO_SAT_VARS];                   // Assigned literals in order
+    int trail_len;                              // Number of assigned literals
+    int trail_lim[SUDO_SAT_VARS + 1];           // Trail index where each decision level starts
+    int num_levels;                             // Current decision level
+    int prop_head;                              // Trail index of the next literal to propagate
+    int learnt[SUDO_SAT_VARS];                  // Scratch space for a learned clause
+    bool ready;                                 // Has the encoding been built?
+} sudo_sat_solver_t;
+
+_Thread_local sudo_sat_solver_t sudo_sat_solver;  // This thread's solver
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Append a clause to the arena and watch its first two literals.
+ *
+ *  Args:
+ *      lits: The clause's literals.
+ *      size: The number of literals, at least 2.
+ *
+ *  Returns:
+ *      The clause index, or -1 if the arena (or this solve's clause budget) is full.
+ */
+int add_sat_clause(const int *lits, int size);
+
+/*
+ *  Description:
+ *      Find the first unique implication point of a conflict and build the learned clause in
+ *      learnt, asserting literal first and a literal from the backjump level second.
+ *
+ *  Args:
+ *      conflict: The clause that was falsified.
+ *      size: [Out] The number of literals in the learned clause.
+ *
+ *  Returns:
+ *      The level to backjump to.
+ */
+int analyze_sat_conflict(int conflict, int *size);
+
+/*
+ *  Description:
+ *      Assign a literal true at the current decision level.
+ *
+ *  Args:
+ *      lit: The literal.
+ *      reason: The clause that implied it, or SUDO_SAT_NO_REASON.
+ *
+ *  Returns:
+ *      None
+ */
+void assign_sat_lit(int lit, int reason);
+
+/*
+ *  Description:
+ *      Undo every assignment above a decision level, saving phases.
+ *
+ *  Args:
+ *      level: The decision level to return to.
+ *
+ *  Returns:
+ *      None
+ */
+void backtrack_sat(int level);
+
+/*
+ *  Description:
+ *      Bump a variable's activity, rescaling every activity if it gets too big.
+ *
+ *  Args:
+ *      var: The variable.
+ *
+ *  Returns:
+ *      None
+ */
+void bump_sat_var(int var);
+
+/*
+ *  Description:
+ *      Pick the unassigned cell variable with the highest activity.  Counter variables are never
+ *      decided: once every cell variable is assigned without a conflict, the board is solved.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      The literal to decide, or -1 if every cell variable is assigned.
+ */
+int decide_sat_lit(void);
+
+/*
+ *  Description:
+ *      Encode one exactly-one group: one clause for "at least one" and the sequential counter
+ *      encoding for "at most one".
+ *
+ *  Args:
+ *      vars: The group's nine cell variables.
+ *      group: The group index, which picks its counter variables.
+ *
+ *  Returns:
+ *      None
+ */
+void encode_sat_group(const int vars[9], int group);
+
+/*
+ *  Description:
+ *      Encode the board's constraints once per thread.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      None
+ */
+void init_sat_encoding(void);
+
+/*
+ *  Description:
+ *      The value of a literal.
+ *
+ *  Args:
+ *      lit: The literal.
+ *
+ *  Returns:
+ *      1 if true, 0 if false, SUDO_SAT_UNASSIGNED otherwise.
+ */
+int lit_sat_value(int lit);
+
+/*
+ *  Description:
+ *      The i-th value (1-indexed) of the Luby sequence: 1, 1, 2, 1, 1, 2, 4, ...
+ *
+ *  Args:
+ *      i: The index, at least 1.
+ *
+ *  Returns:
+ *      The value.
+ */
+int luby_sat(int i);
+
+/*
+ *  Description:
+ *      Propagate every assignment on the trail through the watched literals.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      The index of a falsified clause, or -1 if there is no conflict.
+ */
+int propagate_sat(void);
+
+/*
+ *  Description:
+ *      Forget learned clauses and assignments and re-watch the encoding.
+ *
+ *  Args:
+ *      keep_scores: Keep variable activity and phases (for a mid-solve reset).
+ *
+ *  Returns:
+ *      None
+ */
+void reset_sat_solver(bool keep_scores);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_sat(char board[81], int max_learned, int *num_conflicts)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                       // Results of execution
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int conflicts = 0;                          // Number of conflicts
+    int restart_conflicts = 0;                  // Conflicts since the last restart
+    int restart_index = 1;                      // Index into the Luby sequence
+    int conflict = -1;                          // Falsified clause
+    int size = 0;                               // Size of a learned clause
+    int level = 0;                              // Level to backjump to
+    int clause = 0;                             // Index of a learned clause
+    int lit = 0;                                // Literal to decide
+    int num_facts = 0;                          // Level zero assignments kept across a reset
+
+    // INPUT VALIDATION
+    results = validate_board(board);
+    if (ENOERR == results && max_learned < 0)
+    {
+        results = EINVAL;  // Negative budget
+    }
+
+    // SETUP
+    if (ENOERR == results)
+    {
+        solver->max_clauses = SUDO_SAT_MAX_CLAUSES;  // Room for the encoding
+        init_sat_encoding();
+        if (max_learned > 0 && max_learned < SUDO_SAT_MAX_CLAUSES - solver->num_encoded)
+        {
+            solver->max_clauses = solver->num_encoded + max_learned;
+        }
+        reset_sat_solver(false);
+        for (int cell = 0; cell < SUDO_BOARD_LEN && ENOERR == results; cell++)
+        {
+            if (SUDO_EMPTY_GRID != board[cell])
+            {
+                lit = 2 * ((cell * 9) + (board[cell] - '1'));
+                if (0 == lit_sat_value(lit))
+                {
+                    results = ENODATA;  // Contradicts an earlier given
+                }
+                else if (SUDO_SAT_UNASSIGNED == lit_sat_value(lit))
+                {
+                    assign_sat_lit(lit, SUDO_SAT_NO_REASON);
+                }
+            }
+        }
+    }
+
+    // SOLVE IT
+    while (ENOERR == results)
+    {
+        conflict = propagate_sat();
+        if (conflict >= 0)
+        {
+            conflicts++;
+            restart_conflicts++;
+            if (0 == solver->num_levels)
+            {
+                results = ENODATA;  // Conflict without any decisions: unsatisfiable
+                break;
+            }
+            level = analyze_sat_conflict(conflict, &size);
+            backtrack_sat(level);
+            if (1 == size)
+            {
+                assign_sat_lit(solver->learnt[0], SUDO_SAT_NO_REASON);  // Level zero fact
+            }
+            else
+            {
+                clause = add_sat_clause(solver->learnt, size);
+                if (clause < 0)
+                {
+                    // Out of room: start over without the learned clauses but keep every level
+                    // zero fact (the givens and the units learned so far) since they still hold
+                    FPRINTF_ERR("%s Clause arena full, forgetting learned clauses\n",
+                                DEBUG_WARNG_STR);
+                    backtrack_sat(0);
+                    num_facts = solver->trail_len;
+                    memcpy(solver->learnt, solver->trail, num_facts * sizeof(solver->trail[0]));
+                    reset_sat_solver(true);
+                    for (int i = 0; i < num_facts; i++)
+                    {
+                        if (SUDO_SAT_UNASSIGNED == lit_sat_value(solver->learnt[i]))
+                        {
+                            assign_sat_lit(solver->learnt[i], SUDO_SAT_NO_REASON);
+                        }
+                    }
+                    restart_conflicts = 0;
+                    continue;
+                }
+                assign_sat_lit(solver->learnt[0], clause);
+            }
+            solver->var_inc /= SUDO_SAT_DECAY;
+            if (restart_conflicts >= luby_sat(restart_index) * SUDO_SAT_RESTART_BASE)
+            {
+                backtrack_sat(0);
+                restart_conflicts = 0;
+                restart_index++;
+            }
+        }
+        else
+        {
+            lit = decide_sat_lit();
+            if (lit < 0)
+            {
+                break;  // Every cell is assigned: solved
+            }
+            solver->trail_lim[solver->num_levels] = solver->trail_len;
+            solver->num_levels++;
+            assign_sat_lit(lit, SUDO_SAT_NO_REASON);
+        }
+    }
+
+    // EXPORT IT
+    if (ENOERR == results)
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            for (int digit = 0; digit < 9; digit++)
+            {
+                if (1 == solver->value[(cell * 9) + digit])
+                {
+                    board[cell] = '1' + digit;
+                }
+            }
+        }
+    }
+    FPRINTF_ERR("%s SAT backend hit %d conflicts\n", DEBUG_INFO_STR, conflicts);
+
+    // DONE
+    if (NULL != num_conflicts)
+    {
+        *num_conflicts = conflicts;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int add_sat_clause(const int *lits, int size)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int clause = -1;                               // Index of the new clause
+
+    // ADD IT
+    if (solver->num_clauses < solver->max_clauses
+        && solver->num_lits + size <= SUDO_SAT_MAX_LITS)
+    {
+        clause = solver->num_clauses++;
+        solver->clause_start[clause] = solver->num_lits;
+        solver->clause_size[clause] = size;
+        memcpy(solver->lits + solver->num_lits, lits, size * sizeof(lits[0]));
+        solver->num_lits += size;
+        for (int i = 0; i < 2; i++)
+        {
+            solver->watch_next[clause][i] = solver->watch_head[lits[i]];
+            solver->watch_head[lits[i]] = clause;
+        }
+    }
+
+    // DONE
+    return clause;
+}
+
+
+int analyze_sat_conflict(int conflict, int *size)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int path = 0;                // Literals from the current level left to resolve
+    int len = 1;                 // Learned clause length (learnt[0] is saved for the UIP)
+    int lit = -1;                // Literal being resolved on
+    int index = 0;               // Trail index to resume scanning from
+    int clause = conflict;       // Clause being resolved
+    int var = 0;                 // Variable of a literal
+    int *lits = NULL;            // Literals of clause
+    int bt_level = 0;            // Level to backjump to
+    int bt_index = 1;            // Index in learnt of a literal from bt_level
+    int tmp = 0;                 // Swap space
+
+    // RESOLVE
+    index = solver->trail_len - 1;
+    do
+    {
+        lits = solver->lits + solver->clause_start[clause];
+        // A reason clause's first literal is the one it implied
+        for (int i = (lit < 0) ? 0 : 1; i < solver->clause_size[clause]; i++)
+        {
+            var = lits[i] >> 1;
+            if (false == solver->seen[var] && solver->level[var] > 0)
+            {
+                bump_sat_var(var);
+                solver->seen[var] = true;
+                if (solver->level[var] == solver->num_levels)
+                {
+                    path++;
+                }
+                else
+                {
+                    solver->learnt[len++] = lits[i];
+                }
+            }
+        }
+        // Walk back to the next literal to resolve
+        while (false == solver->seen[solver->trail[index] >> 1])
+        {
+            index--;
+        }
+        lit = solver->trail[index--];
+        clause = solver->reason[lit >> 1];
+        solver->seen[lit >> 1] = false;
+        path--;
+    } while (path > 0);
+    solver->learnt[0] = lit ^ 1;
+
+    // FIND THE BACKJUMP LEVEL
+    for (int i = 1; i < len; i++)
+    {
+        var = solver->learnt[i] >> 1;
+        solver->seen[var] = false;
+        if (solver->level[var] > bt_level)
+        {
+            bt_level = solver->level[var];
+            bt_index = i;
+        }
+    }
+    if (len > 1)
+    {
+        // Watch a literal from the backjump level so the clause is unit there
+        tmp = solver->learnt[1];
+        solver->learnt[1] = solver->learnt[bt_index];
+        solver->learnt[bt_index] = tmp;
+    }
+
+    // DONE
+    *size = len;
+    return bt_level;
+}
+
+
+void assign_sat_lit(int lit, int reason)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int var = lit >> 1;                            // Variable of lit
+
+    // ASSIGN IT
+    solver->value[var] = (lit & 1) ? 0 : 1;
+    solver->level[var] = solver->num_levels;
+    solver->reason[var] = reason;
+    solver->trail[solver->trail_len++] = lit;
+
+    // DONE
+    return;
+}
+
+
+void backtrack_sat(int level)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int var = 0;                                   // Variable to unassign
+
+    // UNDO IT
+    if (solver->num_levels > level)
+    {
+        for (int i = solver->trail_len - 1; i >= solver->trail_lim[level]; i--)
+        {
+            var = solver->trail[i] >> 1;
+            solver->phase[var] = (1 == solver->value[var]);
+            solver->value[var] = SUDO_SAT_UNASSIGNED;
+        }
+        solver->trail_len = solver->trail_lim[level];
+        solver->prop_head = solver->trail_len;
+        solver->num_levels = level;
+    }
+
+    // DONE
+    return;
+}
+
+
+void bump_sat_var(int var)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+
+    // BUMP IT
+    solver->activity[var] += solver->var_inc;
+    if (solver->activity[var] > 1e100)
+    {
+        for (int i = 0; i < SUDO_SAT_VARS; i++)
+        {
+            solver->activity[i] *= 1e-100;
+        }
+        solver->var_inc *= 1e-100;
+    }
+
+    // DONE
+    return;
+}
+
+
+int decide_sat_lit(void)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int best = -1;                                 // Unassigned variable with the most activity
+
+    // PICK IT
+    for (int var = 0; var < SUDO_SAT_CELL_VARS; var++)
+    {
+        if (SUDO_SAT_UNASSIGNED == solver->value[var]
+            && (best < 0 || solver->activity[var] > solver->activity[best]))
+        {
+            best = var;
+        }
+    }
+
+    // DONE
+    return (best < 0) ? -1 : (2 * best) + (solver->phase[best] ? 0 : 1);
+}
+
+
+void encode_sat_group(const int vars[9], int group)
+{
+    // LOCAL VARIABLES
+    int clause[9] = { 0 };                                   // Clause to add
+    int counter = SUDO_SAT_CELL_VARS + (group * 8);          // First counter variable: s1
+
+    // AT LEAST ONE
+    for (int i = 0; i < 9; i++)
+    {
+        clause[i] = 2 * vars[i];
+    }
+    add_sat_clause(clause, 9);
+
+    // AT MOST ONE: s(i) means "one of the first i variables is true"
+    // x1 -> s1
+    clause[0] = (2 * vars[0]) + 1;
+    clause[1] = 2 * counter;
+    add_sat_clause(clause, 2);
+    for (int i = 1; i < 8; i++)
+    {
+        // xi -> si
+        clause[0] = (2 * vars[i]) + 1;
+        clause[1] = 2 * (counter + i);
+        add_sat_clause(clause, 2);
+        // s(i-1) -> si
+        clause[0] = (2 * (counter + i - 1)) + 1;
+        clause[1] = 2 * (counter + i);
+        add_sat_clause(clause, 2);
+        // s(i-1) -> ~xi
+        clause[0] = (2 * vars[i]) + 1;
+        clause[1] = (2 * (counter + i - 1)) + 1;
+        add_sat_clause(clause, 2);
+    }
+    // s8 -> ~x9
+    clause[0] = (2 * vars[8]) + 1;
+    clause[1] = (2 * (counter + 7)) + 1;
+    add_sat_clause(clause, 2);
+
+    // DONE
+    return;
+}
+
+
+void init_sat_encoding(void)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int vars[9] = { 0 };                           // Cell variables of a group
+    int group = 0;                                 // Group index
+    int box_cell = 0;                              // First cell of a 3x3 grid
+
+    // ENCODE IT
+    if (false == solver->ready)
+    {
+        memset(solver->watch_head, 0xFF, sizeof(solver->watch_head));  // All -1
+        solver->num_clauses = 0;
+        solver->num_lits = 0;
+        // Each cell holds one digit
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            for (int digit = 0; digit < 9; digit++)
+            {
+                vars[digit] = (cell * 9) + digit;
+            }
+            encode_sat_group(vars, group++);
+        }
+        // Each row, col, and grid holds each digit once
+        for (int unit = 0; unit < 9; unit++)
+        {
+            box_cell = ((unit / 3) * 27) + ((unit % 3) * 3);
+            for (int digit = 0; digit < 9; digit++)
+            {
+                for (int i = 0; i < 9; i++)
+                {
+                    vars[i] = (((unit * 9) + i) * 9) + digit;
+                }
+                encode_sat_group(vars, group++);
+                for (int i = 0; i < 9; i++)
+                {
+                    vars[i] = (((i * 9) + unit) * 9) + digit;
+                }
+                encode_sat_group(vars, group++);
+                for (int i = 0; i < 9; i++)
+                {
+                    vars[i] = ((box_cell + ((i / 3) * 9) + (i % 3)) * 9) + digit;
+                }
+                encode_sat_group(vars, group++);
+            }
+        }
+        solver->num_encoded = solver->num_clauses;
+        solver->num_encoded_lits = solver->num_lits;
+        solver->ready = true;
+        FPRINTF_ERR("%s Encoded %d clauses over %d variables\n", DEBUG_INFO_STR,
+                    solver->num_encoded, SUDO_SAT_VARS);
+    }
+
+    // DONE
+    return;
+}
+
+
+int lit_sat_value(int lit)
+{
+    // LOCAL VARIABLES
+    int8_t value = sudo_sat_solver.value[lit >> 1];  // Value of lit's variable
+
+    // DONE
+    return (SUDO_SAT_UNASSIGNED == value) ? SUDO_SAT_UNASSIGNED : value ^ (lit & 1);
+}
+
+
+int luby_sat(int i)
+{
+    // LOCAL VARIABLES
+    int k = 1;  // Smallest k where 2^k - 1 >= i
+
+    // FIND IT
+    while (true)
+    {
+        for (k = 1; (1 << k) - 1 < i; k++);
+        if ((1 << k) - 1 == i)
+        {
+            break;  // End of a run: 2^(k-1)
+        }
+        i -= (1 << (k - 1)) - 1;  // Repeat the earlier prefix
+    }
+
+    // DONE
+    return 1 << (k - 1);
+}
+
+
+int propagate_sat(void)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int conflict = -1;     // Falsified clause
+    int false_lit = 0;     // Literal that just became false
+    int *link = NULL;      // Link to the watcher being visited
+    int clause = 0;        // Clause being visited
+    int *lits = NULL;      // Literals of clause
+    int tmp = 0;           // Swap space
+    bool moved = false;    // Did the clause find a new literal to watch?
+
+    // PROPAGATE
+    while (conflict < 0 && solver->prop_head < solver->trail_len)
+    {
+        false_lit = solver->trail[solver->prop_head++] ^ 1;
+        link = solver->watch_head + false_lit;
+        while (conflict < 0 && *link >= 0)
+        {
+            clause = *link;
+            lits = solver->lits + solver->clause_start[clause];
+            // Keep the false literal second
+            if (lits[0] == false_lit)
+            {
+                lits[0] = lits[1];
+                lits[1] = false_lit;
+                tmp = solver->watch_next[clause][0];
+                solver->watch_next[clause][0] = solver->watch_next[clause][1];
+                solver->watch_next[clause][1] = tmp;
+            }
+            if (1 == lit_sat_value(lits[0]))
+            {
+                link = solver->watch_next[clause] + 1;
+                continue;  // Already satisfied
+            }
+            // Look for a new literal to watch
+            moved = false;
+            for (int i = 2; i < solver->clause_size[clause]; i++)
+            {
+                if (0 != lit_sat_value(lits[i]))
+                {
+                    lits[1] = lits[i];
+                    lits[i] = false_lit;
+                    *link = solver->watch_next[clause][1];
+                    solver->watch_next[clause][1] = solver->watch_head[lits[1]];
+                    solver->watch_head[lits[1]] = clause;
+                    moved = true;
+                    break;
+                }
+            }
+            if (true == moved)
+            {
+                continue;  // *link already points at the next watcher
+            }
+            link = solver->watch_next[clause] + 1;
+            if (0 == lit_sat_value(lits[0]))
+            {
+                conflict = clause;  // Every literal is false
+            }
+            else
+            {
+                assign_sat_lit(lits[0], clause);  // Unit
+            }
+        }
+    }
+
+    // DONE
+    return conflict;
+}
+
+
+void reset_sat_solver(bool keep_scores)
+{
+    // LOCAL VARIABLES
+    sudo_sat_solver_t *solver = &sudo_sat_solver;  // This thread's solver
+    int *lits = NULL;                              // Literals of a clause
+
+    // FORGET IT
+    solver->num_clauses = solver->num_encoded;
+    solver->num_lits = solver->num_encoded_lits;
+    memset(solver->watch_head, 0xFF, sizeof(solver->watch_head));  // All -1
+    for (int clause = 0; clause < solver->num_clauses; clause++)
+    {
+        lits = solver->lits + solver->clause_start[clause];
+        for (int i = 0; i < 2; i++)
+        {
+            solver->watch_next[clause][i] = solver->watch_head[lits[i]];
+            solver->watch_head[lits[i]] = clause;
+        }
+    }
+    memset(solver->value, SUDO_SAT_UNASSIGNED, sizeof(solver->value));
+    memset(solver->seen, 0, sizeof(solver->seen));
+    solver->trail_len = 0;
+    solver->prop_head = 0;
+    solver->num_levels = 0;
+    if (false == keep_scores)
+    {
+        memset(solver->activity, 0, sizeof(solver->activity));
+        memset(solver->phase, true, sizeof(solver->phase));
+        solver->var_inc = 1.0;
+    }
+
+    // DONE
+    return;
+}
@@ -0,0 +1,434 @@
+/*
+ *  This library defines the depth-first search fallback on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EAGAIN, EINVAL, ENODATA
+#include <limits.h>                         // INT_MAX
+#include <stdbool.h>                        // bool, false, true
+#include <stddef.h>                         // size_t
+#include <stdint.h>                         // uint64_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_search.h"                    // count_search(), solve_search(), sudo_restart_t
+#include "sudo_state.h"                     // sudo_state_t, sudo_trail_t, play_sudo_digit()
+#include "sudo_ttable.h"                    // probe_sudo_ttable(), store_sudo_ttable()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/*
+ *  One search run (or count): its node budget, its random stream if randomized, and the
+ *  caller's cache of refuted subtrees.
+ */
+typedef struct
+{
+    long long num_nodes;    // Nodes visited so far, over every run
+    long long node_limit;   // Give up on the run once num_nodes passes this, 0 for no limit
+    bool randomize;         // Randomize tie-breaks and value ordering
+    uint64_t rng;           // SplitMix64 state
+    sudo_ttable_t *table;   // Hashes of refuted subtrees, or NULL
+    int limit;              // Counting: stop after this many solutions
+    int num_solutions;      // Counting: solutions found so far
+    char (*witnesses)[81];  // Counting: where to write the solutions found, or NULL
+} sudo_search_t;
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Propagate singles and then count the solutions under every candidate of the most
+ *      constrained cell, undoing each branch with the state's trail.
+ *
+ *  Args:
+ *      state: [In/Out] The recording solver state.
+ *      search: The count.  Counts every node visited and every solution found.
+ *
+ *  Returns:
+ *      None
+ */
+void count_node(sudo_state_t *state, sudo_search_t *search);
+
+/*
+ *  Description:
+ *      The i-th value (1-indexed) of the Luby sequence: 1, 1, 2, 1, 1, 2, 4, ...
+ *
+ *  Args:
+ *      i: The index, at least 1.
+ *
+ *  Returns:
+ *      The value.
+ */
+int luby_search(int i);
+
+/*
+ *  Description:
+ *      Draw the next number from a run's random stream (SplitMix64).
+ *
+ *  Args:
+ *      search: The run.
+ *
+ *  Returns:
+ *      A uniformly distributed 64-bit value.
+ */
+uint64_t next_search_random(sudo_search_t *search);
+
+/*
+ *  Description:
+ *      Find the empty cell with the fewest candidates.  A randomized run picks uniformly among
+ *      the cells tied for fewest.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      search: The run.
+ *
+ *  Returns:
+ *      A cell index 0-80, or -1 if the board is full.
+ */
+int pick_search_cell(const sudo_state_t *state, sudo_search_t *search);
+
+/*
+ *  Description:
+ *      Run one search from the state's root level, undoing it if it fails.
+ *
+ *  Args:
+ *      state: [In/Out] The recording solver state.  Holds the solution on success.
+ *      search: The run.
+ *
+ *  Returns:
+ *      ENOERR if a solution was found, ENODATA if there is none, EAGAIN if the run hit its node
+ *      limit first.
+ */
+int run_search(sudo_state_t *state, sudo_search_t *search);
+
+/*
+ *  Description:
+ *      Propagate singles and then try every candidate of the most constrained cell, undoing each
+ *      failed branch with the state's trail.
+ *
+ *  Args:
+ *      state: [In/Out] The recording solver state.  Holds the solution on success.
+ *      search: The run.  Counts every node visited.
+ *
+ *  Returns:
+ *      ENOERR if a solution was found, ENODATA if there is none, EAGAIN if the run hit its node
+ *      limit first.
+ */
+int search_node(sudo_state_t *state, sudo_search_t *search);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int count_search(sudo_state_t *state, int limit, int *num_solutions, char witnesses[][81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;          // Results of execution
+    sudo_search_t search = { 0 };  // The count
+    sudo_trail_t trail;            // Undo log for state
+
+    // INPUT VALIDATION
+    if (NULL == state || limit < 1 || NULL == num_solutions)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // COUNT
+    if (ENOERR == results)
+    {
+        search.limit = limit;
+        search.witnesses = witnesses;
+        start_sudo_trail(state, &trail);
+        push_sudo_trail(state);  // The root level, so state is left untouched
+        count_node(state, &search);
+        pop_sudo_trail(state);
+        start_sudo_trail(state, NULL);
+        *num_solutions = search.num_solutions;
+        FPRINTF_ERR("%s Counting visited %lld nodes\n", DEBUG_INFO_STR, search.num_nodes);
+    }
+
+    // DONE
+    return results;
+}
+
+
+int solve_search(sudo_state_t *state, int *num_nodes)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;    // Results of execution
+    uint64_t all_nodes = 0;  // Search nodes visited
+
+    // SEARCH
+    results = solve_search_restarts(state, SUDO_RESTART_NONE, 1, 0, NULL, &all_nodes);
+
+    // DONE
+    if (NULL != num_nodes)
+    {
+        *num_nodes = (all_nodes > INT_MAX) ? INT_MAX : all_nodes;
+    }
+    return results;
+}
+
+
+int solve_search_restarts(sudo_state_t *state, sudo_restart_t restart, int base, uint64_t seed,
+                          sudo_ttable_t *table, uint64_t *num_nodes)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                  // Results of execution
+    sudo_search_t search = { 0 };          // The current run
+    sudo_trail_t trail;                    // Undo log for state
+    long long limit = 0;                   // Node budget for the current run
+    int run = 0;                           // Number of runs started
+
+    // INPUT VALIDATION
+    if (NULL == state || base < 1 || restart < SUDO_RESTART_NONE
+        || restart > SUDO_RESTART_GEOMETRIC || (NULL != table && NULL == table->slots))
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // SEARCH
+    if (ENOERR == results)
+    {
+        search.randomize = (SUDO_RESTART_NONE != restart);
+        search.rng = seed;
+        search.table = table;
+        start_sudo_trail(state, &trail);
+        do
+        {
+            run++;
+            if (SUDO_RESTART_LUBY == restart)
+            {
+                limit = (long long)luby_search(run) * base;
+            }
+            else if (SUDO_RESTART_GEOMETRIC == restart)
+            {
+                limit = (run < 32) ? (1LL << (run - 1)) * base : 0;  // 0: the last run is unbounded
+            }
+            search.node_limit = (0 == limit) ? 0 : search.num_nodes + limit;
+            results = run_search(state, &search);
+        } while (EAGAIN == results);
+        start_sudo_trail(state, NULL);  // Keep the solution (if any)
+        FPRINTF_ERR("%s Search visited %lld nodes over %d runs\n", DEBUG_INFO_STR,
+                    search.num_nodes, run);
+    }
+
+    // DONE
+    if (NULL != num_nodes)
+    {
+        *num_nodes = search.num_nodes;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+void count_node(sudo_state_t *state, sudo_search_t *search)
+{
+    // LOCAL VARIABLES
+    int cell = -1;  // Cell to branch on
+
+    // PROPAGATE
+    search->num_nodes++;
+    propagate_sudo_singles(state, SUDO_BOARD_LEN, NULL);  // 81 plays always reach a fixed point
+    if (true == state->contradiction)
+    {
+        goto done;  // Dead end
+    }
+    if (0 == state->num_empty)
+    {
+        if (NULL != search->witnesses)
+        {
+            export_sudo_state(state, search->witnesses[search->num_solutions]);
+        }
+        search->num_solutions++;  // Found one
+        goto done;
+    }
+
+    // BRANCH
+    cell = pick_search_cell(state, search);
+    for (uint16_t cands = state->cands[cell]; cands && search->num_solutions < search->limit;
+         cands &= cands - 1)
+    {
+        push_sudo_trail(state);
+        play_sudo_digit(state, cell, SUDO_CTZ(cands) + 1);
+        count_node(state, search);
+        pop_sudo_trail(state);
+    }
+
+    // DONE
+done:
+    return;
+}
+
+
+int luby_search(int i)
+{
+    // LOCAL VARIABLES
+    int k = 1;  // Smallest k where 2^k - 1 >= i
+
+    // FIND IT
+    while (true)
+    {
+        for (k = 1; (1 << k) - 1 < i; k++);
+        if ((1 << k) - 1 == i)
+        {
+            break;  // End of a run: 2^(k-1)
+        }
+        i -= (1 << (k - 1)) - 1;  // Repeat the earlier prefix
+    }
+
+    // DONE
+    return 1 << (k - 1);
+}
+
+
+uint64_t next_search_random(sudo_search_t *search)
+{
+    // LOCAL VARIABLES
+    uint64_t z = (search->rng += 0x9E3779B97F4A7C15ULL);  // Weyl sequence step
+
+    // MIX IT
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    // DONE
+    return z ^ (z >> 31);
+}
+
+
+int pick_search_cell(const sudo_state_t *state, sudo_search_t *search)
+{
+    // LOCAL VARIABLES
+    int best = -1;        // Empty cell with the fewest candidates
+    int best_count = 10;  // Number of candidates for best
+    int num_ties = 0;     // Number of cells seen with best_count candidates
+    int count = 0;        // Number of candidates for a cell
+
+    // PICK IT
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (0 == state->cells[cell])
+        {
+            count = SUDO_POPCOUNT(state->cands[cell]);
+            if (count < best_count)
+            {
+                best = cell;
+                best_count = count;
+                num_ties = 1;
+            }
+            else if (count == best_count && true == search->randomize)
+            {
+                num_ties++;
+                if (0 == next_search_random(search) % num_ties)
+                {
+                    best = cell;  // Reservoir sampling: each tie is kept with equal odds
+                }
+            }
+            if (2 == best_count && false == search->randomize)
+            {
+                break;  // Can't beat two
+            }
+        }
+    }
+
+    // DONE
+    return best;
+}
+
+
+int run_search(sudo_state_t *state, sudo_search_t *search)
+{
+    // LOCAL VARIABLES
+    int results = ENODATA;  // Results of execution
+
+    // RUN IT
+    push_sudo_trail(state);  // The root level, so a failed run leaves state untouched
+    results = search_node(state, search);
+    if (ENOERR != results)
+    {
+        pop_sudo_trail(state);
+    }
+
+    // DONE
+    return results;
+}
+
+
+int search_node(sudo_state_t *state, sudo_search_t *search)
+{
+    // LOCAL VARIABLES
+    int results = ENODATA;  // Results of execution
+    int cell = -1;          // Cell to branch on
+    int digits[9] = { 0 };  // The branch cell's candidates, in the order to try them
+    int num_digits = 0;     // Number of entries in digits
+    int pick = 0;           // Index of a digit to swap into place
+    int tmp = 0;            // Swap space
+
+    // PROPAGATE
+    search->num_nodes++;
+    if (0 != search->node_limit && search->num_nodes > search->node_limit)
+    {
+        results = EAGAIN;  // This run is over budget
+        goto done;
+    }
+    propagate_sudo_singles(state, SUDO_BOARD_LEN, NULL);  // 81 plays always reach a fixed point
+    if (true == state->contradiction)
+    {
+        goto done;  // Dead end
+    }
+    if (0 == state->num_empty)
+    {
+        results = ENOERR;  // Solved
+        goto done;
+    }
+    if (true == probe_sudo_ttable(search->table, state->hash))
+    {
+        goto done;  // An earlier run (or solve) already refuted this state
+    }
+
+    // ORDER THE BRANCHES
+    cell = pick_search_cell(state, search);
+    for (uint16_t cands = state->cands[cell]; cands; cands &= cands - 1)
+    {
+        digits[num_digits++] = SUDO_CTZ(cands) + 1;
+    }
+    for (int i = num_digits - 1; i > 0 && true == search->randomize; i--)
+    {
+        pick = next_search_random(search) % (i + 1);  // Fisher-Yates shuffle
+        tmp = digits[i];
+        digits[i] = digits[pick];
+        digits[pick] = tmp;
+    }
+
+    // BRANCH
+    for (int i = 0; i < num_digits && ENODATA == results; i++)
+    {
+        push_sudo_trail(state);
+        play_sudo_digit(state, cell, digits[i]);
+        results = search_node(state, search);
+        if (ENOERR != results)
+        {
+            pop_sudo_trail(state);  // Dead end (or out of budget): undo the branch
+        }
+    }
+    if (ENODATA == results && NULL != search->table)
+    {
+        store_sudo_ttable(search->table, state->hash);  // Every branch was refuted
+    }
+
+    // DONE
+done:
+    return results;
+}
@@ -0,0 +1,602 @@
+/*
+ *  This library defines the bitmask solver state used by SUDO's game logic.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA, EOVERFLOW
+#include <stdatomic.h>                      // atomic_int, atomic_load(), atomic_store()
+#include <stdbool.h>                        // bool, false, true
+#include <string.h>                         // memset()
+#include "sudo_debug.h"                     // MODULE_*LOAD(), PRINT_ERRNO(), PRINT_ERROR()
+#include "sudo_kernel.h"                    // assign_sudo_digit(), eliminate_sudo_candidate()
+#include "sudo_macros.h"                    // ENOERR, SUDO_DISPATCH, SUDO_EMPTY_GRID
+#include "sudo_state.h"                     // sudo_state_t
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+uint8_t sudo_peers[81][SUDO_NUM_PEERS];  // The 20 peers of each cell
+sudo_cellset_t sudo_peer_sets[81];       // The 20 peers of each cell, as a cell set
+sudo_cellset_t sudo_unit_sets[27];       // The cells of each unit, as a cell set
+uint8_t sudo_unit_cells[27][9];          // The cells of each unit, in slot order
+uint8_t sudo_cell_units[81][3];          // The row, col, and grid unit of each cell
+uint8_t sudo_cell_slots[81][3];          // The slot of each cell within those units
+uint64_t sudo_zobrist[81][9];            // Random key for each cell and digit index
+atomic_int sudo_tables_stage = 0;        // 0 unpopulated, 1 being populated, 2 ready
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Compute the candidate mask of every cell and the slot mask of every unit and digit from
+ *      the placed digits.  Both loops are branch-free over fixed trip counts so they vectorize,
+ *      and they are built for each ISA SUDO_DISPATCH supports.
+ *
+ *  Args:
+ *      state: The solver state to update.  Its cells and unit_used must be set and its cands and
+ *          unit_pos zeroed.
+ *
+ *  Returns:
+ *      None
+ */
+void compute_sudo_cands(sudo_state_t *state);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int export_sudo_state(const sudo_state_t *state, char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == state || NULL == board)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // EXPORT IT
+    if (ENOERR == results)
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            board[cell] = state->cells[cell] ? state->cells[cell] + '0' : SUDO_EMPTY_GRID;
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+int init_sudo_state(sudo_state_t *state, const char board[81])
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int digit = 0;         // Digit found in the board
+    uint16_t bit = 0;      // Mask bit for digit
+    int unit = 0;          // Unit index
+
+    // INPUT VALIDATION
+    if (NULL == state || NULL == board)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // SETUP
+    if (ENOERR == results)
+    {
+        init_sudo_tables();
+        memset(state, 0, sizeof(*state));
+    }
+
+    // RECORD THE GIVENS
+    if (ENOERR == results)
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            if (SUDO_EMPTY_GRID == board[cell])
+            {
+                continue;  // Nothing to record
+            }
+            digit = board[cell] - '0';
+            bit = SUDO_DIGIT_BIT(digit);
+            for (int i = 0; i < 3; i++)
+            {
+                unit = sudo_cell_units[cell][i];
+                if (state->unit_used[unit] & bit)
+                {
+                    results = EINVAL;  // Duplicate entry
+                    FPRINTF_ERR("%s Duplicate entry '%d' found at index %d\n", DEBUG_ERROR_STR,
+                                digit, cell);
+                    goto done;
+                }
+                state->unit_used[unit] |= bit;
+            }
+            state->cells[cell] = digit;
+            state->hash ^= sudo_zobrist[cell][digit - 1];
+        }
+    }
+
+    // COMPUTE CANDIDATES
+    if (ENOERR == results)
+    {
+        compute_sudo_cands(state);
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            if (0 == state->cells[cell])
+            {
+                state->num_empty++;
+                check_sudo_cands(state, cell);
+            }
+        }
+        for (unit = 0; unit < SUDO_NUM_UNITS; unit++)
+        {
+            for (digit = 1; digit <= 9; digit++)
+            {
+                check_sudo_slots(state, unit, digit);
+            }
+        }
+    }
+
+    // DONE
+done:
+    return results;
+}
+
+
+void init_sudo_tables(void)
+{
+    // LOCAL VARIABLES
+    int num_peers = 0;     // Number of peers found for a cell
+    int row = 0;           // Row index of a cell
+    int col = 0;           // Column index of a cell
+    int box = 0;           // Grid index of a cell
+    int box_slot = 0;      // Slot of a cell within its grid
+    uint64_t key = 0;      // SplitMix64 state for the Zobrist keys
+    uint64_t mix = 0;      // One Zobrist key being mixed
+    int stage = 0;         // Expected value of sudo_tables_stage
+
+    // POPULATE THEM
+    // Only the first caller to claim them (stage 0 -> 1) does the work
+    if (2 != atomic_load(&sudo_tables_stage)
+        && true == atomic_compare_exchange_strong(&sudo_tables_stage, &stage, 1))
+    {
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            // Units and slots
+            row = SUDO_CELL_ROW(cell);
+            col = SUDO_CELL_COL(cell);
+            box = SUDO_CELL_BOX(cell);
+            box_slot = ((row % 3) * 3) + (col % 3);
+            sudo_cell_units[cell][0] = SUDO_ROW_UNIT(row);
+            sudo_cell_units[cell][1] = SUDO_COL_UNIT(col);
+            sudo_cell_units[cell][2] = SUDO_BOX_UNIT(box);
+            sudo_cell_slots[cell][0] = col;
+            sudo_cell_slots[cell][1] = row;
+            sudo_cell_slots[cell][2] = box_slot;
+            sudo_unit_cells[SUDO_ROW_UNIT(row)][col] = cell;
+            sudo_unit_cells[SUDO_COL_UNIT(col)][row] = cell;
+            sudo_unit_cells[SUDO_BOX_UNIT(box)][box_slot] = cell;
+            SUDO_CELLSET_ADD(sudo_unit_sets[SUDO_ROW_UNIT(row)], cell);
+            SUDO_CELLSET_ADD(sudo_unit_sets[SUDO_COL_UNIT(col)], cell);
+            SUDO_CELLSET_ADD(sudo_unit_sets[SUDO_BOX_UNIT(box)], cell);
+            // Peers
+            num_peers = 0;
+            for (int peer = 0; peer < SUDO_BOARD_LEN; peer++)
+            {
+                if (peer != cell && (SUDO_CELL_ROW(peer) == row || SUDO_CELL_COL(peer) == col
+                                     || SUDO_CELL_BOX(peer) == box))
+                {
+                    sudo_peers[cell][num_peers] = peer;
+                    SUDO_CELLSET_ADD(sudo_peer_sets[cell], peer);
+                    num_peers++;
+                }
+            }
+            // Zobrist keys: a fixed seed keeps hashes stable from run to run
+            for (int digit = 1; digit <= 9; digit++)
+            {
+                key += 0x9E3779B97F4A7C15ULL;
+                mix = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                mix = (mix ^ (mix >> 27)) * 0x94D049BB133111EBULL;
+                sudo_zobrist[cell][digit - 1] = mix ^ (mix >> 31);
+            }
+        }
+        atomic_store(&sudo_tables_stage, 2);  // Publish them
+    }
+
+    // WAIT FOR THEM
+    while (2 != atomic_load(&sudo_tables_stage));  // Another thread may still be populating them
+
+    // DONE
+    return;
+}
+
+
+int next_sudo_hidden(sudo_state_t *state, int *digit)
+{
+    // LOCAL VARIABLES
+    int cell = -1;       // The next queued cell
+    int pair = 0;        // Queued (unit * 9) + (digit - 1) pair
+    int unit = 0;        // Unit index from pair
+    int dig = 0;         // Digit from pair
+    uint16_t slots = 0;  // Slot mask for unit and dig
+
+    // POP IT
+    if (NULL != state && NULL != digit)
+    {
+        while (state->hidden_head < state->hidden_tail)
+        {
+            pair = state->hidden_queue[state->hidden_head];
+            state->hidden_head++;
+            unit = pair / 9;
+            dig = (pair % 9) + 1;
+            slots = state->unit_pos[unit][dig - 1];
+            if (0 == (state->unit_used[unit] & SUDO_DIGIT_BIT(dig)) && 1 == SUDO_POPCOUNT(slots))
+            {
+                cell = sudo_unit_cells[unit][SUDO_CTZ(slots)];  // Found one
+                *digit = dig;
+                break;
+            }
+        }
+    }
+
+    // DONE
+    return cell;
+}
+
+
+int next_sudo_single(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int cell = -1;  // The next queued cell
+
+    // POP IT
+    if (NULL != state)
+    {
+        while (state->single_head < state->single_tail)
+        {
+            cell = state->single_queue[state->single_head];
+            state->single_head++;
+            if (0 == state->cells[cell])
+            {
+                break;  // Found one
+            }
+            cell = -1;  // Already filled in... keep looking
+        }
+    }
+
+    // DONE
+    return cell;
+}
+
+
+SUDO_DISPATCH int propagate_sudo_singles(sudo_state_t *state, int budget, int *num_plays)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int plays = 0;         // Number of plays made
+    int cell = -1;         // Queued cell to solve
+    int digit = 0;         // Digit that belongs in cell
+
+    // INPUT VALIDATION
+    if (NULL == state || budget < 0)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // PROPAGATE
+    while (ENOERR == results && state->num_empty > 0 && false == state->contradiction)
+    {
+        if (plays >= budget)
+        {
+            results = ENODATA;  // Out of budget before reaching a fixed point
+            break;
+        }
+        cell = next_sudo_single(state);
+        if (cell >= 0)
+        {
+            digit = get_sudo_single(state, cell);
+            if (0 == digit)
+            {
+                continue;  // Already flagged as a contradiction
+            }
+        }
+        else
+        {
+            cell = next_sudo_hidden(state, &digit);
+            if (cell < 0)
+            {
+                break;  // Fixed point
+            }
+        }
+        assign_sudo_digit(state, cell, digit);  // Queued, so a legal play
+        plays++;
+    }
+
+    // DONE
+    if (NULL != num_plays)
+    {
+        *num_plays = plays;
+    }
+    return results;
+}
+
+
+int pop_sudo_trail(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                 // Results of execution
+    sudo_trail_t *trail = NULL;           // The state's undo log
+    sudo_trail_frame_t *frame = NULL;     // Snapshot for the level being closed
+    sudo_trail_entry_t *entry = NULL;     // Entry being undone
+    int index = 0;                        // Flat unit_pos index of entry
+
+    // INPUT VALIDATION
+    if (NULL == state || NULL == state->trail || state != state->trail->owner)
+    {
+        results = EINVAL;  // Not recording
+    }
+    else if (state->trail->depth < 1)
+    {
+        results = ENODATA;  // Nothing to undo
+    }
+
+    // UNDO IT
+    if (ENOERR == results)
+    {
+        trail = state->trail;
+        trail->depth--;
+        frame = trail->frames + trail->depth;
+        // Replay the log, newest first
+        while (trail->len > frame->trail_len)
+        {
+            trail->len--;
+            entry = trail->entries + trail->len;
+            if (entry->index < SUDO_TRAIL_CELLS(0))
+            {
+                state->cands[entry->index] = entry->value;
+            }
+            else if (entry->index < SUDO_TRAIL_USED(0))
+            {
+                state->cells[entry->index - SUDO_TRAIL_CELLS(0)] = entry->value;
+            }
+            else if (entry->index < SUDO_TRAIL_POS(0, 1))
+            {
+                state->unit_used[entry->index - SUDO_TRAIL_USED(0)] = entry->value;
+            }
+            else
+            {
+                index = entry->index - SUDO_TRAIL_POS(0, 1);
+                state->unit_pos[index / 9][index % 9] = entry->value;
+            }
+        }
+        // Restore the snapshot
+        state->num_empty = frame->num_empty;
+        state->hash = frame->hash;
+        state->contradiction = frame->contradiction;
+        state->single_head = frame->single_head;
+        state->single_tail = frame->single_tail;
+        state->hidden_head = frame->hidden_head;
+        state->hidden_tail = frame->hidden_tail;
+        memcpy(state->strong_units, frame->strong_units, sizeof(state->strong_units));
+    }
+
+    // DONE
+    return results;
+}
+
+
+int push_sudo_trail(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                 // Results of execution
+    sudo_trail_t *trail = NULL;           // The state's undo log
+    sudo_trail_frame_t *frame = NULL;     // Snapshot for the new level
+
+    // INPUT VALIDATION
+    if (NULL == state || NULL == state->trail || state != state->trail->owner)
+    {
+        results = EINVAL;  // Not recording
+    }
+    else if (state->trail->depth >= SUDO_TRAIL_DEPTH)
+    {
+        results = EOVERFLOW;  // Too many open levels
+    }
+
+    // SNAPSHOT IT
+    if (ENOERR == results)
+    {
+        trail = state->trail;
+        frame = trail->frames + trail->depth;
+        trail->depth++;
+        frame->trail_len = trail->len;
+        frame->num_empty = state->num_empty;
+        frame->hash = state->hash;
+        frame->contradiction = state->contradiction;
+        frame->single_head = state->single_head;
+        frame->single_tail = state->single_tail;
+        frame->hidden_head = state->hidden_head;
+        frame->hidden_tail = state->hidden_tail;
+        memcpy(frame->strong_units, state->strong_units, sizeof(frame->strong_units));
+    }
+
+    // DONE
+    return results;
+}
+
+
+int place_sudo_digit(sudo_state_t *state, int cell, int digit)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;   // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == state || cell < 0 || cell >= SUDO_BOARD_LEN || digit < 1 || digit > 9)
+    {
+        results = EINVAL;  // Bad input
+    }
+    else if (0 == (state->cands[cell] & SUDO_DIGIT_BIT(digit)))
+    {
+        results = EINVAL;  // Not a legal play
+    }
+
+    // PLACE IT
+    if (ENOERR == results)
+    {
+        play_sudo_digit(state, cell, digit);
+    }
+
+    // DONE
+    return results;
+}
+
+
+SUDO_DISPATCH void play_sudo_digit(sudo_state_t *state, int cell, int digit)
+{
+    // PLACE IT
+    assign_sudo_digit(state, cell, digit);
+
+    // DONE
+    return;
+}
+
+
+int remove_sudo_candidate(sudo_state_t *state, int cell, int digit)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == state || cell < 0 || cell >= SUDO_BOARD_LEN || digit < 1 || digit > 9)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // REMOVE IT
+    if (ENOERR == results && false == eliminate_sudo_candidate(state, cell, digit))
+    {
+        results = ENODATA;  // Nothing to remove
+    }
+
+    // DONE
+    return results;
+}
+
+
+int remove_sudo_cells(sudo_state_t *state, sudo_cellset_t cells, int digit)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;  // Number of candidates removed
+    int cell = -1;      // Cell to update
+
+    // INPUT VALIDATION
+    if (NULL != state && digit >= 1 && digit <= 9)
+    {
+        // REMOVE THEM
+        while ((cell = pop_sudo_cellset(&cells)) >= 0)
+        {
+            num_elims += eliminate_sudo_candidate(state, cell, digit);
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int remove_sudo_slots(sudo_state_t *state, int unit, uint16_t slots, int digit)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;  // Number of candidates removed
+
+    // INPUT VALIDATION
+    if (NULL != state && unit >= 0 && unit < SUDO_NUM_UNITS && digit >= 1 && digit <= 9)
+    {
+        // REMOVE THEM
+        for (slots &= 0x1FF; slots; slots &= slots - 1)
+        {
+            num_elims += eliminate_sudo_candidate(state, sudo_unit_cells[unit][SUDO_CTZ(slots)],
+                                                  digit);
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int start_sudo_trail(sudo_state_t *state, sudo_trail_t *trail)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // START IT
+    if (ENOERR == results)
+    {
+        if (NULL != trail)
+        {
+            trail->owner = state;
+            trail->len = 0;
+            trail->depth = 0;
+        }
+        state->trail = trail;
+    }
+
+    // DONE
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+SUDO_DISPATCH void compute_sudo_cands(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    uint16_t used = 0;   // Digits placed in a cell's units
+    uint16_t cands = 0;  // Candidate mask of one cell
+
+    // CANDIDATE MASKS
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        used = state->unit_used[sudo_cell_units[cell][0]]
+               | state->unit_used[sudo_cell_units[cell][1]]
+               | state->unit_used[sudo_cell_units[cell][2]];
+        state->cands[cell] = (0 == state->cells[cell]) ? SUDO_ALL_CANDS & ~used : 0;
+    }
+
+    // SLOT MASKS
+    for (int unit = 0; unit < SUDO_NUM_UNITS; unit++)
+    {
+        for (int slot = 0; slot < 9; slot++)
+        {
+            cands = state->cands[sudo_unit_cells[unit][slot]];
+            for (int index = 0; index < 9; index++)
+            {
+                state->unit_pos[unit][index] |= ((cands >> index) & 1) << slot;
+            }
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
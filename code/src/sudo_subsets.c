@@ -0,0 +1,238 @@
+/*
+ *  This library defines the naked and hidden subset (pair, triple, quad) strategy for SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, remove_sudo_slots()
+#include "sudo_subsets.h"                   // solve_subsets()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+// Every 9-bit mask with exactly two bits set
+const uint16_t sudo_combos_2[36] = {
+    0x003, 0x005, 0x006, 0x009, 0x00A, 0x00C, 0x011, 0x012, 0x014, 0x018,
+    0x021, 0x022, 0x024, 0x028, 0x030, 0x041, 0x042, 0x044, 0x048, 0x050,
+    0x060, 0x081, 0x082, 0x084, 0x088, 0x090, 0x0A0, 0x0C0, 0x101, 0x102,
+    0x104, 0x108, 0x110, 0x120, 0x140, 0x180,
+};
+// Every 9-bit mask with exactly three bits set
+const uint16_t sudo_combos_3[84] = {
+    0x007, 0x00B, 0x00D, 0x00E, 0x013, 0x015, 0x016, 0x019, 0x01A, 0x01C,
+    0x023, 0x025, 0x026, 0x029, 0x02A, 0x02C, 0x031, 0x032, 0x034, 0x038,
+    0x043, 0x045, 0x046, 0x049, 0x04A, 0x04C, 0x051, 0x052, 0x054, 0x058,
+    0x061, 0x062, 0x064, 0x068, 0x070, 0x083, 0x085, 0x086, 0x089, 0x08A,
+    0x08C, 0x091, 0x092, 0x094, 0x098, 0x0A1, 0x0A2, 0x0A4, 0x0A8, 0x0B0,
+    0x0C1, 0x0C2, 0x0C4, 0x0C8, 0x0D0, 0x0E0, 0x103, 0x105, 0x106, 0x109,
+    0x10A, 0x10C, 0x111, 0x112, 0x114, 0x118, 0x121, 0x122, 0x124, 0x128,
+    0x130, 0x141, 0x142, 0x144, 0x148, 0x150, 0x160, 0x181, 0x182, 0x184,
+    0x188, 0x190, 0x1A0, 0x1C0,
+};
+// Every 9-bit mask with exactly four bits set
+const uint16_t sudo_combos_4[126] = {
+    0x00F, 0x017, 0x01B, 0x01D, 0x01E, 0x027, 0x02B, 0x02D, 0x02E, 0x033,
+    0x035, 0x036, 0x039, 0x03A, 0x03C, 0x047, 0x04B, 0x04D, 0x04E, 0x053,
+    0x055, 0x056, 0x059, 0x05A, 0x05C, 0x063, 0x065, 0x066, 0x069, 0x06A,
+    0x06C, 0x071, 0x072, 0x074, 0x078, 0x087, 0x08B, 0x08D, 0x08E, 0x093,
+    0x095, 0x096, 0x099, 0x09A, 0x09C, 0x0A3, 0x0A5, 0x0A6, 0x0A9, 0x0AA,
+    0x0AC, 0x0B1, 0x0B2, 0x0B4, 0x0B8, 0x0C3, 0x0C5, 0x0C6, 0x0C9, 0x0CA,
+    0x0CC, 0x0D1, 0x0D2, 0x0D4, 0x0D8, 0x0E1, 0x0E2, 0x0E4, 0x0E8, 0x0F0,
+    0x107, 0x10B, 0x10D, 0x10E, 0x113, 0x115, 0x116, 0x119, 0x11A, 0x11C,
+    0x123, 0x125, 0x126, 0x129, 0x12A, 0x12C, 0x131, 0x132, 0x134, 0x138,
+    0x143, 0x145, 0x146, 0x149, 0x14A, 0x14C, 0x151, 0x152, 0x154, 0x158,
+    0x161, 0x162, 0x164, 0x168, 0x170, 0x183, 0x185, 0x186, 0x189, 0x18A,
+    0x18C, 0x191, 0x192, 0x194, 0x198, 0x1A1, 0x1A2, 0x1A4, 0x1A8, 0x1B0,
+    0x1C1, 0x1C2, 0x1C4, 0x1C8, 0x1D0, 0x1E0,
+};
+// Combination tables indexed by size
+const uint16_t *sudo_combos[SUDO_MAX_SUBSET + 1] = {
+    NULL, NULL, sudo_combos_2, sudo_combos_3, sudo_combos_4
+};
+// Length of each combination table
+const int sudo_num_combos[SUDO_MAX_SUBSET + 1] = { 0, 0, 36, 84, 126 };
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      HIDDEN SUBSET: If size digits only have size slots left in a unit, no other digit can go
+ *      in those slots.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      unit: The unit index, 0-26.
+ *      size: The size of the subset, 2-4.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_hidden_subsets(sudo_state_t *state, int unit, int size);
+
+/*
+ *  Description:
+ *      NAKED SUBSET: If size cells in a unit only have size candidates between them, those
+ *      candidates can't go anywhere else in the unit.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      unit: The unit index, 0-26.
+ *      size: The size of the subset, 2-4.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_naked_subsets(sudo_state_t *state, int unit, int size);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_subsets(sudo_state_t *state, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int total_elims = 0;   // Number of candidates eliminated
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        // Smaller subsets are cheaper to find so stop at the first size that makes progress
+        for (int size = 2; size <= SUDO_MAX_SUBSET && 0 == total_elims; size++)
+        {
+            for (int unit = 0; unit < SUDO_NUM_UNITS && false == state->contradiction; unit++)
+            {
+                total_elims += find_naked_subsets(state, unit, size);
+                total_elims += find_hidden_subsets(state, unit, size);
+            }
+        }
+        FPRINTF_ERR("%s Subsets eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int find_hidden_subsets(sudo_state_t *state, int unit, int size)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;      // Number of candidates eliminated
+    uint16_t open = 0;      // Digits not yet placed in unit
+    uint16_t digits = 0;    // Combination of digits to check
+    uint16_t slots = 0;     // Union of the digits' slot masks
+    uint16_t others = 0;    // The other open digits
+
+    // SETUP
+    open = SUDO_ALL_CANDS & ~state->unit_used[unit];
+
+    // FIND THEM
+    if (SUDO_POPCOUNT(open) > size)
+    {
+        for (int i = 0; i < sudo_num_combos[size]; i++)
+        {
+            digits = sudo_combos[size][i];
+            if (digits & ~open)
+            {
+                continue;  // One of these digits is already placed
+            }
+            slots = 0;
+            for (uint16_t tmp = digits; tmp; tmp &= tmp - 1)
+            {
+                slots |= state->unit_pos[unit][SUDO_CTZ(tmp)];
+            }
+            if (SUDO_POPCOUNT(slots) != size)
+            {
+                continue;  // Not a hidden subset
+            }
+            // Nothing else can go in these slots
+            for (others = open & ~digits; others; others &= others - 1)
+            {
+                num_elims += remove_sudo_slots(state, unit,
+                                               state->unit_pos[unit][SUDO_CTZ(others)] & slots,
+                                               SUDO_CTZ(others) + 1);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_naked_subsets(sudo_state_t *state, int unit, int size)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;      // Number of candidates eliminated
+    uint16_t empty = 0;     // Slots of the empty cells in unit
+    uint16_t slots = 0;     // Combination of slots to check
+    uint16_t digits = 0;    // Union of the slots' candidate masks
+    uint8_t *cells = NULL;  // Cells of the unit in slot order
+
+    // SETUP
+    cells = sudo_unit_cells[unit];
+    for (int slot = 0; slot < 9; slot++)
+    {
+        if (0 == state->cells[cells[slot]])
+        {
+            empty |= 1 << slot;
+        }
+    }
+
+    // FIND THEM
+    if (SUDO_POPCOUNT(empty) > size)
+    {
+        for (int i = 0; i < sudo_num_combos[size]; i++)
+        {
+            slots = sudo_combos[size][i];
+            if (slots & ~empty)
+            {
+                continue;  // One of these cells is already solved
+            }
+            digits = 0;
+            for (uint16_t tmp = slots; tmp; tmp &= tmp - 1)
+            {
+                digits |= state->cands[cells[SUDO_CTZ(tmp)]];
+            }
+            if (SUDO_POPCOUNT(digits) != size)
+            {
+                continue;  // Not a naked subset
+            }
+            // These digits can't go anywhere else
+            for (uint16_t tmp = digits; tmp; tmp &= tmp - 1)
+            {
+                num_elims += remove_sudo_slots(state, unit,
+                                               state->unit_pos[unit][SUDO_CTZ(tmp)] & ~slots,
+                                               SUDO_CTZ(tmp) + 1);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
@@ -0,0 +1,247 @@
+/*
+ *  This library defines the template (pattern overlay) engine on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stdatomic.h>                      // atomic_int, atomic_load(), atomic_store()
+#include <stdbool.h>                        // bool, false, true
+#include <stddef.h>                         // size_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, remove_sudo_*()
+#include "sudo_template.h"                  // solve_templates()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+sudo_cellset_t sudo_templates[SUDO_NUM_TEMPLATES];  // Every template as a cell set
+atomic_int sudo_templates_stage = 0;                // 0 unpopulated, 1 being populated, 2 ready
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Apply the templates to one digit.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      digit: The digit, 1-9.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int filter_templates(sudo_state_t *state, int digit);
+
+/*
+ *  Description:
+ *      Populate sudo_templates on first use.  Safe to call from any number of threads at once:
+ *      the first one populates the templates and the rest wait for it to publish them.
+ *
+ *  Args:
+ *      None
+ *
+ *  Returns:
+ *      None
+ */
+void init_sudo_templates(void);
+
+/*
+ *  Description:
+ *      Recursively place one cell per row, skipping used cols and, within a band of three rows,
+ *      used stacks of three cols.
+ *
+ *  Args:
+ *      row: The row to place, 0-9.  Row 9 means the template is complete.
+ *      used_cols: Mask of the cols already used.
+ *      used_stacks: Mask of the stacks already used in this row's band.
+ *      partial: The cells placed so far.
+ *      num_templates: [In/Out] Index of the next free entry in sudo_templates.
+ *
+ *  Returns:
+ *      None
+ */
+void place_template_row(int row, uint16_t used_cols, uint16_t used_stacks, sudo_cellset_t partial,
+                        int *num_templates);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_templates(sudo_state_t *state, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int total_elims = 0;   // Number of candidates eliminated
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        init_sudo_templates();
+        for (int digit = 1; digit <= 9 && false == state->contradiction; digit++)
+        {
+            total_elims += filter_templates(state, digit);
+        }
+        FPRINTF_ERR("%s Templates eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int filter_templates(sudo_state_t *state, int digit)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;                            // Number of candidates eliminated
+    sudo_cellset_t placed = { { 0, 0 } };         // Cells the digit is placed in
+    sudo_cellset_t allowed = { { 0, 0 } };        // Cells the digit is placed in or a candidate for
+    sudo_cellset_t any = { { 0, 0 } };            // Cells some surviving template covers
+    sudo_cellset_t every = { { ~0ULL, ~0ULL } };  // Cells every surviving template covers
+    sudo_cellset_t gone = { { 0, 0 } };           // Cells no surviving template covers
+    const sudo_cellset_t *tmpl = NULL;            // Current template
+    bool survived = false;                        // Did any template survive?
+    int cell = -1;                                // Cell to update
+
+    // SETUP
+    for (cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (digit == state->cells[cell])
+        {
+            SUDO_CELLSET_ADD(placed, cell);
+            SUDO_CELLSET_ADD(allowed, cell);
+        }
+        else if (state->cands[cell] & SUDO_DIGIT_BIT(digit))
+        {
+            SUDO_CELLSET_ADD(allowed, cell);
+        }
+    }
+
+    // FILTER THEM
+    for (int i = 0; i < SUDO_NUM_TEMPLATES; i++)
+    {
+        tmpl = sudo_templates + i;
+        if ((tmpl->bits[0] & ~allowed.bits[0]) | (tmpl->bits[1] & ~allowed.bits[1])
+            | (placed.bits[0] & ~tmpl->bits[0]) | (placed.bits[1] & ~tmpl->bits[1]))
+        {
+            continue;  // Doesn't fit
+        }
+        survived = true;
+        any.bits[0] |= tmpl->bits[0];
+        any.bits[1] |= tmpl->bits[1];
+        every.bits[0] &= tmpl->bits[0];
+        every.bits[1] &= tmpl->bits[1];
+    }
+
+    // ELIMINATE
+    if (false == survived)
+    {
+        state->contradiction = true;  // The digit can't be placed nine times
+    }
+    else
+    {
+        // The digit can't go where no template puts it
+        gone.bits[0] = allowed.bits[0] & ~any.bits[0];
+        gone.bits[1] = allowed.bits[1] & ~any.bits[1];
+        num_elims += remove_sudo_cells(state, gone, digit);
+        // The digit must go where every template puts it
+        every.bits[0] &= ~placed.bits[0];
+        every.bits[1] &= ~placed.bits[1];
+        while ((cell = pop_sudo_cellset(&every)) >= 0)
+        {
+            for (uint16_t tmp = state->cands[cell] & ~SUDO_DIGIT_BIT(digit); tmp; tmp &= tmp - 1)
+            {
+                if (ENOERR == remove_sudo_candidate(state, cell, SUDO_CTZ(tmp) + 1))
+                {
+                    num_elims++;
+                }
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+void init_sudo_templates(void)
+{
+    // LOCAL VARIABLES
+    int num_templates = 0;                // Number of templates generated
+    sudo_cellset_t empty = { { 0, 0 } };  // No cells
+    int stage = 0;                        // Expected value of sudo_templates_stage
+
+    // POPULATE THEM
+    // Only the first caller to claim them (stage 0 -> 1) does the work
+    if (2 != atomic_load(&sudo_templates_stage)
+        && true == atomic_compare_exchange_strong(&sudo_templates_stage, &stage, 1))
+    {
+        place_template_row(0, 0, 0, empty, &num_templates);
+        FPRINTF_ERR("%s Generated %d templates\n", DEBUG_INFO_STR, num_templates);
+        atomic_store(&sudo_templates_stage, 2);  // Publish them
+    }
+
+    // WAIT FOR THEM
+    while (2 != atomic_load(&sudo_templates_stage));  // Another thread may still be populating them
+
+    // DONE
+    return;
+}
+
+
+void place_template_row(int row, uint16_t used_cols, uint16_t used_stacks, sudo_cellset_t partial,
+                        int *num_templates)
+{
+    // LOCAL VARIABLES
+    sudo_cellset_t next;  // partial plus this row's cell
+
+    // PLACE IT
+    if (9 == row)
+    {
+        sudo_templates[(*num_templates)++] = partial;  // Complete
+    }
+    else
+    {
+        if (0 == row % 3)
+        {
+            used_stacks = 0;  // New band
+        }
+        for (int col = 0; col < 9; col++)
+        {
+            if ((used_cols & (1 << col)) || (used_stacks & (1 << (col / 3))))
+            {
+                continue;  // Col or stack already used
+            }
+            next = partial;
+            SUDO_CELLSET_ADD(next, (row * 9) + col);
+            place_template_row(row + 1, used_cols | (1 << col), used_stacks | (1 << (col / 3)),
+                               next, num_templates);
+        }
+    }
+
+    // DONE
+    return;
+}
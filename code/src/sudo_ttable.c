@@ -0,0 +1,136 @@
+/*
+ *  This library defines a transposition table on behalf of SUDO's search.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL
+#include <stdatomic.h>                      // atomic_load_explicit(), atomic_store_explicit()
+#include "sudo_debug.h"                     // MODULE_*LOAD()
+#include "sudo_macros.h"                    // ENOERR
+#include "sudo_memory.h"                    // alloc_sudo_mem(), free_sudo_mem()
+#include "sudo_ttable.h"                    // sudo_ttable_t
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int clear_sudo_ttable(sudo_ttable_t *table)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == table || NULL == table->slots)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // CLEAR IT
+    if (ENOERR == results)
+    {
+        for (size_t i = 0; i <= table->mask; i++)
+        {
+            atomic_store_explicit(&table->slots[i], 0, memory_order_relaxed);
+        }
+    }
+
+    // DONE
+    return results;
+}
+
+
+int create_sudo_ttable(sudo_ttable_t *table, size_t num_slots)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    size_t len = 1;        // num_slots rounded up to a power of two
+
+    // INPUT VALIDATION
+    if (NULL == table || 0 == num_slots || num_slots > (SUDO_MAX_SZ >> 1) + 1)
+    {
+        results = EINVAL;  // Bad input
+    }
+
+    // CREATE IT
+    if (ENOERR == results)
+    {
+        while (len < num_slots)
+        {
+            len <<= 1;
+        }
+        table->slots = alloc_sudo_mem(len, sizeof(*table->slots), &results);
+        table->mask = (ENOERR == results) ? len - 1 : 0;  // Zeroized memory is an empty table
+    }
+
+    // DONE
+    return results;
+}
+
+
+int destroy_sudo_ttable(sudo_ttable_t *table)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == table)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // DESTROY IT
+    if (ENOERR == results && NULL != table->slots)
+    {
+        results = free_sudo_mem((void **)&table->slots);
+        table->mask = 0;
+    }
+
+    // DONE
+    return results;
+}
+
+
+bool probe_sudo_ttable(const sudo_ttable_t *table, uint64_t hash)
+{
+    // LOCAL VARIABLES
+    bool hit = false;  // Was the hash found?
+
+    // PROBE IT
+    if (NULL != table && NULL != table->slots && 0 != hash)
+    {
+        hit = (hash == atomic_load_explicit(table->slots + (hash & table->mask),
+                                            memory_order_relaxed));
+    }
+
+    // DONE
+    return hit;
+}
+
+
+int store_sudo_ttable(sudo_ttable_t *table, uint64_t hash)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+
+    // INPUT VALIDATION
+    if (NULL == table || NULL == table->slots)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // STORE IT
+    if (ENOERR == results && 0 != hash)
+    {
+        atomic_store_explicit(table->slots + (hash & table->mask), hash, memory_order_relaxed);
+    }
+
+    // DONE
+    return results;
+}
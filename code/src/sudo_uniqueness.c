@@ -0,0 +1,336 @@
+/*
+ *  This library defines the uniqueness (Unique Rectangle, BUG+1) strategies on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <stddef.h>                         // size_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, remove_sudo_*()
+#include "sudo_uniqueness.h"                // solve_uniqueness()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Look for a BUG+1.
+ *
+ *  Args:
+ *      state: The solver state.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_bug_plus_one(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      Check one rectangle for Unique Rectangle types 1 through 4 on one pair of digits.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      corners: The four cells of the rectangle.
+ *      pair: The two digits all four corners share.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_rectangle(sudo_state_t *state, const int corners[4], uint16_t pair);
+
+/*
+ *  Description:
+ *      Look for Unique Rectangles.
+ *
+ *  Args:
+ *      state: The solver state.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_unique_rectangles(sudo_state_t *state);
+
+/*
+ *  Description:
+ *      UNIQUE RECTANGLE TYPE 3: Treat the roof cells' extra candidates as one cell and look for a
+ *      naked subset it forms with other empty cells in unit.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      unit: A unit both roof cells belong to.
+ *      roof_slots: The roof cells' slot mask within unit.
+ *      extras: The roof cells' extra candidates.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_rectangle_subset(sudo_state_t *state, int unit, uint16_t roof_slots, uint16_t extras);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_uniqueness(sudo_state_t *state, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;  // Results of execution
+    int total_elims = 0;   // Number of candidates eliminated
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        total_elims = find_unique_rectangles(state);
+        if (0 == total_elims && false == state->contradiction)
+        {
+            total_elims = find_bug_plus_one(state);
+        }
+        FPRINTF_ERR("%s Uniqueness eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int find_bug_plus_one(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;     // Number of candidates eliminated
+    int odd_cell = -1;     // The one empty cell that isn't bivalue
+    int num_cands = 0;     // Number of candidates for a cell
+    int digit = 0;         // The candidate that must go in odd_cell
+    uint16_t others = 0;   // The odd cell's other candidates
+
+    // FIND IT
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        num_cands = SUDO_POPCOUNT(state->cands[cell]);
+        if (0 == num_cands || 2 == num_cands)
+        {
+            continue;  // Solved or bivalue
+        }
+        if (3 != num_cands || odd_cell >= 0)
+        {
+            odd_cell = -1;  // Not a BUG+1
+            goto done;
+        }
+        odd_cell = cell;
+    }
+    if (odd_cell >= 0)
+    {
+        for (uint16_t tmp = state->cands[odd_cell]; tmp; tmp &= tmp - 1)
+        {
+            digit = SUDO_CTZ(tmp) + 1;
+            if (3 == SUDO_POPCOUNT(state->unit_pos[sudo_cell_units[odd_cell][0]][digit - 1])
+                && 3 == SUDO_POPCOUNT(state->unit_pos[sudo_cell_units[odd_cell][1]][digit - 1])
+                && 3 == SUDO_POPCOUNT(state->unit_pos[sudo_cell_units[odd_cell][2]][digit - 1]))
+            {
+                // Any other candidate leaves every cell bivalue: a deadly pattern
+                for (others = state->cands[odd_cell] & ~SUDO_DIGIT_BIT(digit); others;
+                     others &= others - 1)
+                {
+                    if (ENOERR == remove_sudo_candidate(state, odd_cell, SUDO_CTZ(others) + 1))
+                    {
+                        num_elims++;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    // DONE
+done:
+    return num_elims;
+}
+
+
+int find_rectangle(sudo_state_t *state, const int corners[4], uint16_t pair)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;        // Number of candidates eliminated
+    int roofs[4] = { 0 };     // Corners with candidates other than pair
+    int num_roofs = 0;        // Number of entries in roofs
+    uint16_t extras = 0;      // Union of the roof cells' extra candidates
+    uint16_t roof_slots = 0;  // The roof cells' slot mask within a shared unit
+    int unit = 0;             // A unit both roof cells belong to
+    uint16_t digit_bit = 0;   // Mask bit for a digit of pair
+    sudo_cellset_t targets;   // Cells that see both roof cells
+
+    // SORT THEM
+    for (int i = 0; i < 4; i++)
+    {
+        if (state->cands[corners[i]] != pair)
+        {
+            roofs[num_roofs++] = corners[i];
+            extras |= state->cands[corners[i]] & ~pair;
+        }
+    }
+
+    // TYPE 1
+    if (1 == num_roofs)
+    {
+        for (uint16_t tmp = pair; tmp; tmp &= tmp - 1)
+        {
+            if (ENOERR == remove_sudo_candidate(state, roofs[0], SUDO_CTZ(tmp) + 1))
+            {
+                num_elims++;
+            }
+        }
+    }
+    else if (2 == num_roofs)
+    {
+        // TYPE 2
+        if (1 == SUDO_POPCOUNT(extras) && state->cands[roofs[0]] == state->cands[roofs[1]])
+        {
+            targets = and_sudo_cellset(sudo_peer_sets[roofs[0]], sudo_peer_sets[roofs[1]]);
+            num_elims += remove_sudo_cells(state, targets, SUDO_CTZ(extras) + 1);
+        }
+        // TYPES 3 AND 4
+        for (int i = 0; i < 3 && 0 == num_elims && false == state->contradiction; i++)
+        {
+            unit = sudo_cell_units[roofs[0]][i];
+            if (unit != sudo_cell_units[roofs[1]][i])
+            {
+                continue;  // Not a shared unit
+            }
+            roof_slots = (1 << sudo_cell_slots[roofs[0]][i]) | (1 << sudo_cell_slots[roofs[1]][i]);
+            if (SUDO_POPCOUNT(extras) > 1)
+            {
+                num_elims += find_rectangle_subset(state, unit, roof_slots, extras);
+            }
+            for (uint16_t tmp = pair; tmp && 0 == num_elims; tmp &= tmp - 1)
+            {
+                digit_bit = tmp & -tmp;
+                if (state->unit_pos[unit][SUDO_CTZ(digit_bit)] == roof_slots)
+                {
+                    // One roof holds this digit, so neither can hold the other
+                    num_elims += remove_sudo_slots(state, unit, roof_slots,
+                                                   SUDO_CTZ(pair & ~digit_bit) + 1);
+                }
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_rectangle_subset(sudo_state_t *state, int unit, uint16_t roof_slots, uint16_t extras)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;    // Number of candidates eliminated
+    uint16_t others = 0;  // Slots of the unit's other empty cells
+    uint16_t digits = 0;  // Union of extras and a subset of others' candidates
+    int size = 0;         // Size of the naked subset, counting the roof cells as one
+
+    // SETUP
+    for (int slot = 0; slot < 9; slot++)
+    {
+        if (state->cands[sudo_unit_cells[unit][slot]])
+        {
+            others |= 1 << slot;
+        }
+    }
+    others &= ~roof_slots;
+    size = SUDO_POPCOUNT(extras);
+
+    // FIND IT
+    for (uint16_t subset = others; subset && 0 == num_elims; subset = (subset - 1) & others)
+    {
+        if (SUDO_POPCOUNT(subset) != size - 1)
+        {
+            continue;  // Wrong size
+        }
+        digits = extras;
+        for (uint16_t tmp = subset; tmp; tmp &= tmp - 1)
+        {
+            digits |= state->cands[sudo_unit_cells[unit][SUDO_CTZ(tmp)]];
+        }
+        if (SUDO_POPCOUNT(digits) != size)
+        {
+            continue;  // Not a naked subset
+        }
+        for (uint16_t tmp = digits; tmp; tmp &= tmp - 1)
+        {
+            num_elims += remove_sudo_slots(state, unit,
+                                           state->unit_pos[unit][SUDO_CTZ(tmp)] & others & ~subset,
+                                           SUDO_CTZ(tmp) + 1);
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_unique_rectangles(sudo_state_t *state)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;        // Number of candidates eliminated
+    int corners[4] = { 0 };   // The four cells of a rectangle
+    uint16_t common = 0;      // Candidates all four corners share
+    uint16_t pair = 0;        // Two of those candidates
+
+    // FIND THEM
+    for (int r1 = 0; r1 < 9 && 0 == num_elims; r1++)
+    {
+        for (int r2 = r1 + 1; r2 < 9 && 0 == num_elims; r2++)
+        {
+            for (int c1 = 0; c1 < 9 && 0 == num_elims; c1++)
+            {
+                for (int c2 = c1 + 1; c2 < 9 && 0 == num_elims; c2++)
+                {
+                    if ((r1 / 3 == r2 / 3) == (c1 / 3 == c2 / 3))
+                    {
+                        continue;  // A rectangle must span exactly two 3x3 grids
+                    }
+                    corners[0] = (r1 * 9) + c1;
+                    corners[1] = (r1 * 9) + c2;
+                    corners[2] = (r2 * 9) + c1;
+                    corners[3] = (r2 * 9) + c2;
+                    common = state->cands[corners[0]] & state->cands[corners[1]]
+                             & state->cands[corners[2]] & state->cands[corners[3]];
+                    for (uint16_t first = common; first && 0 == num_elims; first &= first - 1)
+                    {
+                        for (uint16_t second = first & (first - 1); second && 0 == num_elims;
+                             second &= second - 1)
+                        {
+                            pair = (first & -first) | (second & -second);
+                            num_elims += find_rectangle(state, corners, pair);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
@@ -0,0 +1,315 @@
+/*
+ *  This library defines the wing (XY-Wing, XYZ-Wing, W-Wing) strategies on behalf of SUDO.
+ */
+
+// #define SUDO_DEBUG                          // Enable DEBUG logging
+
+#include <errno.h>                          // EINVAL, ENODATA
+#include <string.h>                         // memset()
+#include "sudo_cellset.h"                   // sudo_cellset_t
+#include "sudo_debug.h"                     // MODULE_*LOAD(), FPRINTF_ERR()
+#include "sudo_macros.h"                    // ENOERR, SUDO_BOARD_LEN, SUDO_POPCOUNT(), SUDO_CTZ()
+#include "sudo_state.h"                     // sudo_state_t, sudo_peer_sets, remove_sudo_cells()
+#include "sudo_wings.h"                     // solve_wings()
+
+
+MODULE_LOAD();  // Print the module name being loaded using the gcc constructor attribute
+MODULE_UNLOAD();  // Print the module name being unloaded using the gcc destructor attribute
+
+
+/*
+ *  Cell sets gathered from the candidate masks once per call.
+ */
+typedef struct
+{
+    sudo_cellset_t bivalue;     // Empty cells with exactly two candidates
+    sudo_cellset_t trivalue;    // Empty cells with exactly three candidates
+    sudo_cellset_t digits[9];   // Empty cells with each digit index (digit - 1) as a candidate
+} sudo_wing_sets_t;
+
+
+/**************************************************************************************************/
+/********************************* PRIVATE FUNCTION DECLARATIONS **********************************/
+/**************************************************************************************************/
+
+/*
+ *  Description:
+ *      Look for W-Wings.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      sets: Cell sets gathered from state.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_w_wings(sudo_state_t *state, const sudo_wing_sets_t *sets);
+
+/*
+ *  Description:
+ *      Look for XY-Wings.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      sets: Cell sets gathered from state.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_xy_wings(sudo_state_t *state, const sudo_wing_sets_t *sets);
+
+/*
+ *  Description:
+ *      Look for XYZ-Wings.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      sets: Cell sets gathered from state.
+ *
+ *  Returns:
+ *      The number of candidates eliminated.
+ */
+int find_xyz_wings(sudo_state_t *state, const sudo_wing_sets_t *sets);
+
+/*
+ *  Description:
+ *      Gather the bivalue, trivalue, and per-digit cell sets from the candidate masks.
+ *
+ *  Args:
+ *      state: The solver state.
+ *      sets: [Out] The cell sets to populate.
+ *
+ *  Returns:
+ *      None
+ */
+void gather_sudo_wing_sets(const sudo_state_t *state, sudo_wing_sets_t *sets);
+
+/**************************************************************************************************/
+/********************************** PUBLIC FUNCTION DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+
+int solve_wings(sudo_state_t *state, int *num_elims)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;    // Results of execution
+    int total_elims = 0;     // Number of candidates eliminated
+    sudo_wing_sets_t sets;   // Cell sets gathered from state
+
+    // INPUT VALIDATION
+    if (NULL == state)
+    {
+        results = EINVAL;  // We shall not abide NULL pointers
+    }
+
+    // ELIMINATE
+    if (ENOERR == results)
+    {
+        gather_sudo_wing_sets(state, &sets);
+        total_elims = find_xy_wings(state, &sets);
+        if (0 == total_elims && false == state->contradiction)
+        {
+            total_elims = find_xyz_wings(state, &sets);
+        }
+        if (0 == total_elims && false == state->contradiction)
+        {
+            total_elims = find_w_wings(state, &sets);
+        }
+        FPRINTF_ERR("%s Wings eliminated %d candidates\n", DEBUG_INFO_STR, total_elims);
+        results = (total_elims > 0) ? ENOERR : ENODATA;
+    }
+
+    // DONE
+    if (NULL != num_elims)
+    {
+        *num_elims = total_elims;
+    }
+    return results;
+}
+
+
+/**************************************************************************************************/
+/********************************** PRIVATE FUNCTION DEFINITIONS **********************************/
+/**************************************************************************************************/
+
+
+int find_w_wings(sudo_state_t *state, const sudo_wing_sets_t *sets)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;         // Number of candidates eliminated
+    sudo_cellset_t outer;      // Bivalue cells left to try as the first cell
+    sudo_cellset_t inner;      // Bivalue cells left to try as the second cell
+    int first = -1;            // First cell of the wing
+    int second = -1;           // Second cell of the wing
+    uint16_t pair = 0;         // The candidates both cells share
+    uint16_t link = 0;         // The linked digit's slots in a unit
+    int ends[2] = { 0 };       // The cells at either end of a strong link
+    int digit = 0;             // The digit that links the cells
+    int other = 0;             // The digit that gets eliminated
+
+    // FIND THEM
+    outer = sets->bivalue;
+    while (0 == num_elims && (first = pop_sudo_cellset(&outer)) >= 0)
+    {
+        pair = state->cands[first];
+        inner = outer;
+        while (0 == num_elims && (second = pop_sudo_cellset(&inner)) >= 0)
+        {
+            if (2 != SUDO_POPCOUNT(pair) || pair != state->cands[second]
+                || SUDO_CELLSET_HAS(sudo_peer_sets[first], second))
+            {
+                continue;  // Not a pair of matching cells that can't see each other
+            }
+            for (uint16_t tmp = pair; tmp && 0 == num_elims; tmp &= tmp - 1)
+            {
+                digit = SUDO_CTZ(tmp) + 1;
+                other = SUDO_CTZ(pair & ~SUDO_DIGIT_BIT(digit)) + 1;
+                for (uint32_t units = state->strong_units[digit - 1]; units && 0 == num_elims;
+                     units &= units - 1)
+                {
+                    link = state->unit_pos[SUDO_CTZ(units)][digit - 1];
+                    ends[0] = sudo_unit_cells[SUDO_CTZ(units)][SUDO_CTZ(link)];
+                    ends[1] = sudo_unit_cells[SUDO_CTZ(units)][SUDO_CTZ(link & (link - 1))];
+                    if ((SUDO_CELLSET_HAS(sudo_peer_sets[first], ends[0])
+                         && SUDO_CELLSET_HAS(sudo_peer_sets[second], ends[1]))
+                        || (SUDO_CELLSET_HAS(sudo_peer_sets[first], ends[1])
+                            && SUDO_CELLSET_HAS(sudo_peer_sets[second], ends[0])))
+                    {
+                        num_elims += remove_sudo_cells(state,
+                            and_sudo_cellset(and_sudo_cellset(sudo_peer_sets[first],
+                                                              sudo_peer_sets[second]),
+                                             sets->digits[other - 1]), other);
+                    }
+                }
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_xy_wings(sudo_state_t *state, const sudo_wing_sets_t *sets)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;         // Number of candidates eliminated
+    sudo_cellset_t pivots;     // Bivalue cells left to try as the pivot
+    sudo_cellset_t pincers;    // Bivalue peers of the pivot
+    sudo_cellset_t others;     // Bivalue peers of the pivot left to try as the second pincer
+    int pivot = -1;            // Pivot cell
+    int first = -1;            // First pincer cell
+    int second = -1;           // Second pincer cell
+    uint16_t shared = 0;       // The candidate both pincers share
+
+    // FIND THEM
+    pivots = sets->bivalue;
+    while ((pivot = pop_sudo_cellset(&pivots)) >= 0 && false == state->contradiction)
+    {
+        pincers = and_sudo_cellset(sets->bivalue, sudo_peer_sets[pivot]);
+        while ((first = pop_sudo_cellset(&pincers)) >= 0)
+        {
+            if (1 != SUDO_POPCOUNT(state->cands[first] & state->cands[pivot]))
+            {
+                continue;  // First pincer must share exactly one candidate with the pivot
+            }
+            others = pincers;
+            while ((second = pop_sudo_cellset(&others)) >= 0)
+            {
+                shared = state->cands[first] & state->cands[second];
+                if (2 != SUDO_POPCOUNT(state->cands[pivot])
+                    || 1 != SUDO_POPCOUNT(shared) || (shared & state->cands[pivot])
+                    || (state->cands[first] | state->cands[second])
+                       != (state->cands[pivot] | shared))
+                {
+                    continue;  // Not an XY-Wing
+                }
+                num_elims += remove_sudo_cells(state,
+                    and_sudo_cellset(and_sudo_cellset(sudo_peer_sets[first],
+                                                      sudo_peer_sets[second]),
+                                     sets->digits[SUDO_CTZ(shared)]), SUDO_CTZ(shared) + 1);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+int find_xyz_wings(sudo_state_t *state, const sudo_wing_sets_t *sets)
+{
+    // LOCAL VARIABLES
+    int num_elims = 0;         // Number of candidates eliminated
+    sudo_cellset_t pivots;     // Trivalue cells left to try as the pivot
+    sudo_cellset_t pincers;    // Bivalue peers of the pivot
+    sudo_cellset_t others;     // Bivalue peers of the pivot left to try as the second pincer
+    sudo_cellset_t targets;    // Cells that see the pivot and both pincers
+    int pivot = -1;            // Pivot cell
+    int first = -1;            // First pincer cell
+    int second = -1;           // Second pincer cell
+    uint16_t shared = 0;       // The candidate all three cells share
+
+    // FIND THEM
+    pivots = sets->trivalue;
+    while ((pivot = pop_sudo_cellset(&pivots)) >= 0 && false == state->contradiction)
+    {
+        pincers = and_sudo_cellset(sets->bivalue, sudo_peer_sets[pivot]);
+        while ((first = pop_sudo_cellset(&pincers)) >= 0)
+        {
+            if (state->cands[first] & ~state->cands[pivot])
+            {
+                continue;  // First pincer's candidates must come from the pivot
+            }
+            others = pincers;
+            while ((second = pop_sudo_cellset(&others)) >= 0)
+            {
+                shared = state->cands[first] & state->cands[second];
+                if (3 != SUDO_POPCOUNT(state->cands[pivot]) || 1 != SUDO_POPCOUNT(shared)
+                    || (state->cands[first] | state->cands[second]) != state->cands[pivot])
+                {
+                    continue;  // Not an XYZ-Wing
+                }
+                targets = and_sudo_cellset(sudo_peer_sets[pivot],
+                                           and_sudo_cellset(sudo_peer_sets[first],
+                                                            sudo_peer_sets[second]));
+                num_elims += remove_sudo_cells(state,
+                                                 and_sudo_cellset(targets,
+                                                                  sets->digits[SUDO_CTZ(shared)]),
+                                                 SUDO_CTZ(shared) + 1);
+            }
+        }
+    }
+
+    // DONE
+    return num_elims;
+}
+
+
+void gather_sudo_wing_sets(const sudo_state_t *state, sudo_wing_sets_t *sets)
+{
+    // LOCAL VARIABLES
+    int num_cands = 0;  // Number of candidates for a cell
+
+    // GATHER THEM
+    memset(sets, 0, sizeof(*sets));
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        num_cands = SUDO_POPCOUNT(state->cands[cell]);
+        if (2 == num_cands)
+        {
+            SUDO_CELLSET_ADD(sets->bivalue, cell);
+        }
+        else if (3 == num_cands)
+        {
+            SUDO_CELLSET_ADD(sets->trivalue, cell);
+        }
+        for (uint16_t tmp = state->cands[cell]; tmp; tmp &= tmp - 1)
+        {
+            SUDO_CELLSET_ADD(sets->digits[SUDO_CTZ(tmp)], cell);
+        }
+    }
+
+    // DONE
+    return;
+}
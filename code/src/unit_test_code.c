@@ -7,7 +7,7 @@
 #include <errno.h>                          // errno
 #include <limits.h>                         // PATH_MAX
 #include <stdlib.h>                         // calloc()
-#include <string.h>                         // strerror()
+#include <string.h>                         // memcpy(), strerror()
 #include <sys/stat.h>                       // stat(), struct stat
 #include <unistd.h>                         // getcwd()
 // Local includes
@@ -318,7 +318,8 @@ char *join_dir_to_path(const char *dirname, const char *pathname, bool must_exis
     if (ENOERR == result)
     {
         // dirname
-        strncpy(joined_path, dirname, strlen(dirname));
+        memcpy(joined_path, dirname, strlen(dirname));
+        joined_path[strlen(dirname)] = '\0';
         // pathname
         if (true == append_path)
         {
@@ -0,0 +1,469 @@
+/*
+ *  Check unit test suit for sudo_batch.h's solve_batch() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_batch_solve_batch.bin && \
+code/dist/check_sudo_batch_solve_batch.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_batch_solve_batch.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_batch_solve_batch.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_batch_solve_batch.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_batch_solve_batch.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_batch_solve_batch.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENODATA
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_batch.h"                 // solve_batch(), SUDO_BATCH_LANES
+#include "sudo_logic.h"                 // is_game_over()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// The most boards one test case solves: enough to refill every lane a few times
+#define TEST_MAX_BOARDS ((3 * SUDO_BATCH_LANES) + 5)
+
+// Take from: https://sudoku.com/easy/
+#define TEST_EASY " 683 9 7  42     11 7 5 6    5 7 12 7    158     3 74    19 2 58 162 39 9  543 1 "
+// Wikipedia's example puzzle
+#define TEST_WIKI "53  7    6  195    98    6 8   6   34  8 3  17   2   6 6    28    419  5    8  79"
+// Naked and hidden singles stall on these, so the scalar solver has to finish them
+#define TEST_HARD_1 "1    7 9  3  2   8  96  5    53  9   1  8   26    4   3      1  4      7  7   3  "
+#define TEST_HARD_2 "       79  4         67 5  9   81       397 6 7       3 2   6  56      3   8    4"
+// Three solutions: singles stall and the scalar solver picks one
+#define TEST_MULTIPLE "        55 93   2      739   325814 6 5173  2182 9  378 4    7 2 7  546131 7   5 "
+// The top-right corner needs a 9 but its col already has one
+#define TEST_DEAD "12345678         9                                                               "
+// Valid and stalls on singles but has no solution, so the scalar solver has to refute it
+#define TEST_UNSAT "1    7 9  3  2   8  96  5    53  9   1  8   26    4   3      1  4      7  7   3 9"
+// A duplicate 6 in the top row
+#define TEST_DUPE " 683 9 76 42     11 7 5 6    5 7 12 7    158     3 74    19 2 58 162 39 9  543 1 "
+// A zero in the bottom-right corner
+#define TEST_ZERO " 683 9 7  42     11 7 5 6    5 7 12 7    158     3 74    19 2 58 162 39 9  543 10"
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Solve copies of the num_boards test_inputs (NULL entries stay NULL) in one batch and check the
+ *  expected return value and per-board results.  Each solved board must be a solved board that
+ *  keeps its test_input's givens, and each invalid board must be left as it was.
+ */
+void run_test_case(const char *test_inputs[], int num_boards, const int exp_results[],
+                   int exp_return);
+
+/*
+ *  Fill test_inputs with num_boards entries cycling through pool, and exp_results with the
+ *  matching entries of pool_results.
+ */
+void cycle_test_inputs(const char *pool[], const int pool_results[], int pool_len,
+                       const char *test_inputs[], int exp_results[], int num_boards);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_n01_one_board)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                    // Expected return value for this test case
+    const char *test_inputs[] = { TEST_EASY };  // Boards for this test case
+    int exp_results[] = { ENOERR };             // Expected per-board results
+
+    // RUN TEST
+    run_test_case(test_inputs, 1, exp_results, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_n02_few_boards)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                                 // Expected return value
+    // Boards for this test case
+    const char *test_inputs[] = { TEST_EASY, TEST_WIKI, TEST_HARD_1, TEST_HARD_2 };
+    int exp_results[] = { ENOERR, ENOERR, ENOERR, ENOERR };  // Expected per-board results
+
+    // RUN TEST
+    run_test_case(test_inputs, 4, exp_results, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_boards)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+
+    // RUN TEST
+    actual_ret = solve_batch(NULL, 1, NULL);
+    ck_assert_msg(exp_return == actual_ret, "solve_batch() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e02_negative_num_boards)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;         // Expected return value for this test case
+    int actual_ret = CANARY_INT;     // Return value of the tested function
+    char board[81] = { TEST_EASY };  // The board to not solve
+    char *boards[] = { board };      // The boards to not solve
+
+    // RUN TEST
+    actual_ret = solve_batch(boards, -1, NULL);
+    ck_assert_msg(exp_return == actual_ret, "solve_batch() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+// NULL and invalid boards are reported without stopping the rest of the batch
+START_TEST(test_e03_invalid_boards)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;  // Expected return value for this test case
+    // Boards for this test case
+    const char *test_inputs[] = { NULL, TEST_EASY, TEST_DUPE, TEST_WIKI, TEST_ZERO, NULL };
+    // Expected per-board results
+    int exp_results[] = { EINVAL, ENOERR, EINVAL, ENOERR, EINVAL, EINVAL };
+
+    // RUN TEST
+    run_test_case(test_inputs, 6, exp_results, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_all_invalid)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;                         // Expected return value
+    const char *test_inputs[] = { TEST_DUPE, NULL };  // Boards for this test case
+    int exp_results[] = { EINVAL, EINVAL };           // Expected per-board results
+
+    // RUN TEST
+    run_test_case(test_inputs, 2, exp_results, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_no_boards)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                    // Expected return value for this test case
+    const char *test_inputs[] = { TEST_EASY };  // Boards for this test case (none are used)
+    int exp_results[] = { ENOERR };             // Expected per-board results (none are used)
+
+    // RUN TEST
+    run_test_case(test_inputs, 0, exp_results, exp_return);
+}
+END_TEST
+
+
+// Exactly one board per lane
+START_TEST(test_b02_full_lanes)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                                     // Expected return value
+    const char *pool[] = { TEST_EASY, TEST_WIKI, TEST_HARD_1 };  // Boards to cycle through
+    int pool_results[] = { ENOERR, ENOERR, ENOERR };             // Expected results for pool
+    const char *test_inputs[SUDO_BATCH_LANES] = { 0 };           // Boards for this test case
+    int exp_results[SUDO_BATCH_LANES] = { 0 };                   // Expected per-board results
+
+    // RUN TEST
+    cycle_test_inputs(pool, pool_results, 3, test_inputs, exp_results, SUDO_BATCH_LANES);
+    run_test_case(test_inputs, SUDO_BATCH_LANES, exp_results, exp_return);
+}
+END_TEST
+
+
+// One board more than there are lanes
+START_TEST(test_b03_one_lane_refill)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                                     // Expected return value
+    const char *pool[] = { TEST_EASY, TEST_WIKI, TEST_HARD_1 };  // Boards to cycle through
+    int pool_results[] = { ENOERR, ENOERR, ENOERR };             // Expected results for pool
+    const char *test_inputs[SUDO_BATCH_LANES + 1] = { 0 };       // Boards for this test case
+    int exp_results[SUDO_BATCH_LANES + 1] = { 0 };               // Expected per-board results
+
+    // RUN TEST
+    cycle_test_inputs(pool, pool_results, 3, test_inputs, exp_results, SUDO_BATCH_LANES + 1);
+    run_test_case(test_inputs, SUDO_BATCH_LANES + 1, exp_results, exp_return);
+}
+END_TEST
+
+
+// results is optional
+START_TEST(test_b04_null_results)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;             // Expected return value for this test case
+    int actual_ret = CANARY_INT;          // Return value of the tested function
+    char solvable[81] = { TEST_EASY };    // A board with a solution
+    char dead[81] = { TEST_DEAD };        // A board without one
+    char *boards[] = { solvable, dead };  // The boards to solve
+
+    // RUN TEST
+    actual_ret = solve_batch(boards, 2, NULL);
+    ck_assert_msg(exp_return == actual_ret, "solve_batch() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    ck_assert_msg(ENOERR == is_game_over(solvable), "The solvable board was not solved");
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Many more boards than lanes, mixing quick and slow ones so lanes retire out of order
+START_TEST(test_s01_lane_refill)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                                          // Expected return value
+    // Boards to cycle through
+    const char *pool[] = { TEST_EASY, TEST_HARD_1, TEST_WIKI, TEST_HARD_2, TEST_MULTIPLE };
+    int pool_results[] = { ENOERR, ENOERR, ENOERR, ENOERR, ENOERR };  // Expected results
+    const char *test_inputs[TEST_MAX_BOARDS] = { 0 };                 // Boards for this test case
+    int exp_results[TEST_MAX_BOARDS] = { 0 };                         // Expected per-board results
+
+    // RUN TEST
+    cycle_test_inputs(pool, pool_results, 5, test_inputs, exp_results, TEST_MAX_BOARDS);
+    run_test_case(test_inputs, TEST_MAX_BOARDS, exp_results, exp_return);
+}
+END_TEST
+
+
+// Lanes that die in the sweep and lanes the scalar solver refutes are both reported
+START_TEST(test_s02_unsolvable_lanes)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;                                  // Expected return value
+    // Boards for this test case
+    const char *test_inputs[] = { TEST_DEAD, TEST_EASY, TEST_UNSAT, TEST_HARD_1 };
+    int exp_results[] = { ENODATA, ENOERR, ENODATA, ENOERR };  // Expected per-board results
+
+    // RUN TEST
+    run_test_case(test_inputs, 4, exp_results, exp_return);
+}
+END_TEST
+
+
+// Every lane stalls on singles and is handed off to the scalar solver
+START_TEST(test_s03_stalled_lanes)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                                           // Expected return value
+    const char *pool[] = { TEST_HARD_1, TEST_HARD_2, TEST_MULTIPLE };  // Boards to cycle through
+    int pool_results[] = { ENOERR, ENOERR, ENOERR };                   // Expected results for pool
+    const char *test_inputs[TEST_MAX_BOARDS] = { 0 };                  // Boards for this test case
+    int exp_results[TEST_MAX_BOARDS] = { 0 };                          // Expected per-board results
+
+    // RUN TEST
+    cycle_test_inputs(pool, pool_results, 3, test_inputs, exp_results, TEST_MAX_BOARDS);
+    run_test_case(test_inputs, TEST_MAX_BOARDS, exp_results, exp_return);
+}
+END_TEST
+
+
+// Every kind of board at once, spread over several refills
+START_TEST(test_s04_everything)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;                          // Expected return value for this test case
+    // Boards to cycle through
+    const char *pool[] = { TEST_EASY, NULL, TEST_HARD_1, TEST_DEAD, TEST_DUPE, TEST_MULTIPLE,
+                           TEST_UNSAT, TEST_HARD_2, TEST_ZERO, TEST_WIKI, TEST_DEAD };
+    // Expected results for pool
+    int pool_results[] = { ENOERR, EINVAL, ENOERR, ENODATA, EINVAL, ENOERR,
+                           ENODATA, ENOERR, EINVAL, ENOERR, ENODATA };
+    const char *test_inputs[TEST_MAX_BOARDS] = { 0 };  // Boards for this test case
+    int exp_results[TEST_MAX_BOARDS] = { 0 };          // Expected per-board results
+
+    // RUN TEST
+    cycle_test_inputs(pool, pool_results, 11, test_inputs, exp_results, TEST_MAX_BOARDS);
+    run_test_case(test_inputs, TEST_MAX_BOARDS, exp_results, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Batch-Solve_Batch");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");              // Normal test cases
+    TCase *tc_error = tcase_create("Error");                // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");          // Error test cases
+    TCase *tc_special = tcase_create("Special");            // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_one_board);
+    tcase_add_test(tc_normal, test_n02_few_boards);
+    tcase_add_test(tc_error, test_e01_null_boards);
+    tcase_add_test(tc_error, test_e02_negative_num_boards);
+    tcase_add_test(tc_error, test_e03_invalid_boards);
+    tcase_add_test(tc_error, test_e04_all_invalid);
+    tcase_add_test(tc_boundary, test_b01_no_boards);
+    tcase_add_test(tc_boundary, test_b02_full_lanes);
+    tcase_add_test(tc_boundary, test_b03_one_lane_refill);
+    tcase_add_test(tc_boundary, test_b04_null_results);
+    tcase_add_test(tc_special, test_s01_lane_refill);
+    tcase_add_test(tc_special, test_s02_unsolvable_lanes);
+    tcase_add_test(tc_special, test_s03_stalled_lanes);
+    tcase_add_test(tc_special, test_s04_everything);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void cycle_test_inputs(const char *pool[], const int pool_results[], int pool_len,
+                       const char *test_inputs[], int exp_results[], int num_boards)
+{
+    // FILL THEM
+    for (int i = 0; i < num_boards; i++)
+    {
+        test_inputs[i] = pool[i % pool_len];
+        exp_results[i] = pool_results[i % pool_len];
+    }
+
+    // DONE
+    return;
+}
+
+
+void run_test_case(const char *test_inputs[], int num_boards, const int exp_results[],
+                   int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;                  // Return value of the tested function
+    char copies[TEST_MAX_BOARDS][81] = { 0 };     // Copies of test_inputs to solve
+    char *boards[TEST_MAX_BOARDS] = { 0 };        // Pointers to copies, or NULL
+    int actual_results[TEST_MAX_BOARDS] = { 0 };  // Per-board results from the tested function
+
+    // SETUP
+    ck_assert_msg(num_boards <= TEST_MAX_BOARDS, "Too many boards for one test case");
+    for (int i = 0; i < num_boards; i++)
+    {
+        actual_results[i] = CANARY_INT;
+        if (NULL != test_inputs[i])
+        {
+            memcpy(copies[i], test_inputs[i], SUDO_BOARD_LEN);
+            boards[i] = copies[i];
+        }
+    }
+
+    // RUN IT
+    // Call the function
+    actual_ret = solve_batch(boards, num_boards, actual_results);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "solve_batch() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Check every board
+    for (int i = 0; i < num_boards; i++)
+    {
+        ck_assert_msg(exp_results[i] == actual_results[i], "Board %d's result was [%d] '%s' "
+                      "instead of [%d] '%s'\n", i, actual_results[i],
+                      strerror(actual_results[i]), exp_results[i], strerror(exp_results[i]));
+        if (NULL == test_inputs[i])
+        {
+            continue;  // Nothing to check
+        }
+        if (ENOERR == exp_results[i])
+        {
+            ck_assert_msg(ENOERR == is_game_over(boards[i]), "Board %d was not solved", i);
+            for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+            {
+                ck_assert_msg(SUDO_EMPTY_GRID == test_inputs[i][cell]
+                              || test_inputs[i][cell] == boards[i][cell],
+                              "Board %d's solution changed the given at index %d", i, cell);
+            }
+        }
+        else if (EINVAL == exp_results[i])
+        {
+            ck_assert_msg(0 == memcmp(boards[i], test_inputs[i], SUDO_BOARD_LEN),
+                          "Invalid board %d was modified", i);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_batch_solve_batch.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
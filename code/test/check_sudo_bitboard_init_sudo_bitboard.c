@@ -0,0 +1,512 @@
+/*
+ *  Check unit test suit for sudo_bitboard.h's init_sudo_bitboard() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_bitboard_init_sudo_bitboard.bin && \
+code/dist/check_sudo_bitboard_init_sudo_bitboard.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_bitboard_init_sudo_bitboard.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_bitboard_init_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_bitboard_init_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_bitboard_init_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_bitboard_init_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL
+#include <stdbool.h>                    // bool, false, true
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_bitboard.h"              // export_sudo_bitboard(), init_sudo_bitboard()
+#include "sudo_cellset.h"               // SUDO_CELLSET_HAS()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Initialize a bitboard from test_input and check the expected return value.  On success,
+ *  export it and verify the round trip reproduces test_input exactly, the unsolved plane holds
+ *  just the empty cells, and every empty cell's candidates are the digits none of its peers hold.
+ */
+void run_test_case(char test_input[81], int exp_return);
+
+/*
+ *  Are cell_a and cell_b different cells that share a row, col, or 3x3 grid?
+ */
+bool are_peers(int cell_a, int cell_b);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Take from: https://sudoku.com/easy/
+START_TEST(test_n01_easy_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+// Take from: https://sudoku.com/extreme/
+START_TEST(test_n02_extreme_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_bitboard)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    actual_ret = init_sudo_bitboard(NULL, test_input);
+    ck_assert_msg(exp_return == actual_ret, "init_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e02_null_board)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+
+    // RUN TEST
+    run_test_case(NULL, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e03_invalid_board_row_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 76"
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_invalid_board_col_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543  1" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e05_invalid_board_grid_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            "642     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e06_invalid_char_zero)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 10" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e07_export_null_pointers)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_bitboard_t bitboard;     // Bitboard to export
+    char board[81] = { 0 };       // Board to export to
+    // The empty sudoku puzzle
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+    actual_ret = export_sudo_bitboard(NULL, board);
+    ck_assert_msg(exp_return == actual_ret, "export_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    actual_ret = export_sudo_bitboard(&bitboard, NULL);
+    ck_assert_msg(exp_return == actual_ret, "export_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_empty)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_b02_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_b03_almost_empty)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                        5                                        " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Nothing left over in the bitboard survives initialization
+START_TEST(test_s01_dirty_bitboard)
+{
+    // LOCAL VARIABLES
+    sudo_bitboard_t bitboard;  // Bitboard to reuse
+    char board[81] = { 0 };    // Exported board
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+    // A different board to leave behind first
+    char other_input[81] = { "534678912"
+                             "672195348"
+                             "198342567"
+                             "859761423"
+                             "426853791"
+                             "713924856"
+                             "961537284"
+                             "287419635"
+                             "345286179" };
+
+    // RUN TEST
+    memset(&bitboard, 0xFF, sizeof(bitboard));
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+    ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+    ck_assert_msg(0 == memcmp(board, test_input, SUDO_BOARD_LEN),
+                  "The round trip through a dirty bitboard changed the board");
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, other_input));
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+    ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+    ck_assert_msg(0 == memcmp(board, test_input, SUDO_BOARD_LEN),
+                  "The round trip through a reused bitboard changed the board");
+}
+END_TEST
+
+
+// Every digit alone in every cell
+START_TEST(test_s02_every_single_given)
+{
+    // LOCAL VARIABLES
+    char test_input[81] = { 0 };  // The sudoku puzzle for this test case
+
+    // RUN TEST
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        for (int digit = 1; digit <= 9; digit++)
+        {
+            memset(test_input, SUDO_EMPTY_GRID, SUDO_BOARD_LEN);
+            test_input[cell] = '0' + digit;
+            run_test_case(test_input, ENOERR);
+        }
+    }
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Bitboard-Init_SUDO_Bitboard");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                        // Normal test cases
+    TCase *tc_error = tcase_create("Error");                          // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                    // Error test cases
+    TCase *tc_special = tcase_create("Special");                      // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_easy_sudoku);
+    tcase_add_test(tc_normal, test_n02_extreme_sudoku);
+    tcase_add_test(tc_error, test_e01_null_bitboard);
+    tcase_add_test(tc_error, test_e02_null_board);
+    tcase_add_test(tc_error, test_e03_invalid_board_row_dupe);
+    tcase_add_test(tc_error, test_e04_invalid_board_col_dupe);
+    tcase_add_test(tc_error, test_e05_invalid_board_grid_dupe);
+    tcase_add_test(tc_error, test_e06_invalid_char_zero);
+    tcase_add_test(tc_error, test_e07_export_null_pointers);
+    tcase_add_test(tc_boundary, test_b01_empty);
+    tcase_add_test(tc_boundary, test_b02_solved);
+    tcase_add_test(tc_boundary, test_b03_almost_empty);
+    tcase_add_test(tc_special, test_s01_dirty_bitboard);
+    tcase_add_test(tc_special, test_s02_every_single_given);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+bool are_peers(int cell_a, int cell_b)
+{
+    // LOCAL VARIABLES
+    bool same_row = (cell_a / 9) == (cell_b / 9);  // Same row?
+    bool same_col = (cell_a % 9) == (cell_b % 9);  // Same col?
+    // Same 3x3 grid?
+    bool same_grid = (cell_a / 27) == (cell_b / 27) && (cell_a % 9) / 3 == (cell_b % 9) / 3;
+
+    // DONE
+    return cell_a != cell_b && (true == same_row || true == same_col || true == same_grid);
+}
+
+
+void run_test_case(char test_input[81], int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_bitboard_t bitboard;     // Bitboard to initialize
+    char board[81] = { 0 };       // Exported board
+    bool exp_cand = false;        // Should a digit be a candidate for a cell?
+
+    // RUN IT
+    // Call the function
+    actual_ret = init_sudo_bitboard(&bitboard, test_input);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "init_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    if (ENOERR != exp_return)
+    {
+        return;  // Nothing to check
+    }
+    // The round trip reproduces the board
+    ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+    ck_assert_msg(0 == memcmp(board, test_input, SUDO_BOARD_LEN),
+                  "The round trip changed the board");
+    // Check every cell's planes
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        ck_assert_msg((SUDO_EMPTY_GRID == test_input[cell])
+                      == SUDO_CELLSET_HAS(bitboard.unsolved, cell),
+                      "Cell %d is in the wrong state in the unsolved plane", cell);
+        for (int digit = 1; digit <= 9; digit++)
+        {
+            if (SUDO_EMPTY_GRID != test_input[cell])
+            {
+                exp_cand = test_input[cell] == '0' + digit;  // Only the placed digit
+            }
+            else
+            {
+                exp_cand = true;  // Unless a peer holds it
+                for (int peer = 0; peer < SUDO_BOARD_LEN; peer++)
+                {
+                    if (true == are_peers(cell, peer) && test_input[peer] == '0' + digit)
+                    {
+                        exp_cand = false;
+                        break;
+                    }
+                }
+            }
+            ck_assert_msg(exp_cand == SUDO_CELLSET_HAS(bitboard.digits[digit - 1], cell),
+                          "Digit %d is in the wrong state for cell %d", digit, cell);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_bitboard_init_sudo_bitboard.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,409 @@
+/*
+ *  Check unit test suit for sudo_bitboard.h's place_sudo_bitboard() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_bitboard_place_sudo_bitboard.bin && \
+code/dist/check_sudo_bitboard_place_sudo_bitboard.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_bitboard_place_sudo_bitboard.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_bitboard_place_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_bitboard_place_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_bitboard_place_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_bitboard_place_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL
+#include <stdbool.h>                    // bool, false, true
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_bitboard.h"              // init_sudo_bitboard(), place_sudo_bitboard()
+#include "sudo_cellset.h"               // SUDO_CELLSET_HAS(), is_empty_sudo_cellset()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// Take from: https://sudoku.com/easy/
+#define TEST_EASY " 683 9 7  42     11 7 5 6    5 7 12 7    158     3 74    19 2 58 162 39 9  543 1 "
+// TEST_EASY's solution
+#define TEST_EASY_SOLVED "568319472342786951197452638685974123734261589219835746473198265851627394926543817"
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Initialize a bitboard from test_input, make the play, and check the expected return value.
+ *  A rejected play must leave the bitboard untouched.  A legal one must solve the cell with
+ *  digit, take every other digit out of the cell, take digit out of the cell's peers, and change
+ *  nothing else.
+ */
+void run_test_case(const char test_input[81], int cell, int digit, int exp_return);
+
+/*
+ *  Are cell_a and cell_b different cells that share a row, col, or 3x3 grid?
+ */
+bool are_peers(int cell_a, int cell_b);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Top-left corner: its solution is a 5
+START_TEST(test_n01_legal_play)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, 0, 5, ENOERR);
+}
+END_TEST
+
+
+// Legal but wrong: index 21's solution is a 4 but 2 is still a candidate
+START_TEST(test_n02_legal_wrong_play)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, 21, 2, ENOERR);
+}
+END_TEST
+
+
+// Play the solution into every empty cell, one at a time
+START_TEST(test_n03_play_the_solution)
+{
+    // LOCAL VARIABLES
+    sudo_bitboard_t bitboard;                 // Bitboard to play on
+    char board[81] = { 0 };                   // Exported board
+    const char *solution = TEST_EASY_SOLVED;  // The board to play
+    const char *test_input = TEST_EASY;       // The board to start from
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (SUDO_EMPTY_GRID == test_input[cell])
+        {
+            ck_assert_msg(ENOERR == place_sudo_bitboard(&bitboard, cell, solution[cell] - '0'),
+                          "Failed to play %c at index %d", solution[cell], cell);
+        }
+    }
+    ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+    ck_assert_msg(0 == memcmp(board, solution, SUDO_BOARD_LEN), "The board was not solved");
+    ck_assert_msg(true == is_empty_sudo_cellset(bitboard.unsolved),
+                  "Solved cells are still marked unsolved");
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_bitboard)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+
+    // RUN TEST
+    actual_ret = place_sudo_bitboard(NULL, 0, 5);
+    ck_assert_msg(exp_return == actual_ret, "place_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e02_cell_out_of_range)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, -1, 5, EINVAL);
+    run_test_case(TEST_EASY, SUDO_BOARD_LEN, 5, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e03_digit_out_of_range)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, 0, 0, EINVAL);
+    run_test_case(TEST_EASY, 0, 10, EINVAL);
+}
+END_TEST
+
+
+// The top row already has a 6, 8, 3, 9, and 7
+START_TEST(test_e04_digit_not_a_candidate)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, 0, 6, EINVAL);  // Row
+    run_test_case(TEST_EASY, 0, 1, EINVAL);  // Col
+    run_test_case(TEST_EASY, 0, 4, EINVAL);  // Grid
+}
+END_TEST
+
+
+// Index 1 is a given 6
+START_TEST(test_e05_cell_already_solved)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, 1, 6, EINVAL);  // Even the digit that's there
+    run_test_case(TEST_EASY, 1, 5, EINVAL);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_first_and_last_cell)
+{
+    // LOCAL VARIABLES
+    // The empty sudoku puzzle
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, 0, 1, ENOERR);
+    run_test_case(test_input, 0, 9, ENOERR);
+    run_test_case(test_input, SUDO_BOARD_LEN - 1, 1, ENOERR);
+    run_test_case(test_input, SUDO_BOARD_LEN - 1, 9, ENOERR);
+}
+END_TEST
+
+
+// The last empty cell's only candidate
+START_TEST(test_b02_last_empty_cell)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "4268 3791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, 40, 5, ENOERR);
+    for (int digit = 1; digit <= 9; digit++)
+    {
+        if (5 != digit)
+        {
+            run_test_case(test_input, 40, digit, EINVAL);
+        }
+    }
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// A play rules the digit out of every peer and nowhere else
+START_TEST(test_s01_peers_after_a_play)
+{
+    // LOCAL VARIABLES
+    sudo_bitboard_t bitboard;  // Bitboard to play on
+    int center = 40;           // The cell to play first
+    // The empty sudoku puzzle
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (center == cell)
+        {
+            continue;  // Tested by test_e05_cell_already_solved()
+        }
+        ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+        ck_assert_int_eq(ENOERR, place_sudo_bitboard(&bitboard, center, 7));
+        ck_assert_msg((true == are_peers(center, cell) ? EINVAL : ENOERR)
+                      == place_sudo_bitboard(&bitboard, cell, 7),
+                      "Playing another 7 at index %d was judged wrong", cell);
+    }
+}
+END_TEST
+
+
+// Every candidate of every empty cell is a legal play, and nothing else is
+START_TEST(test_s02_every_play)
+{
+    // LOCAL VARIABLES
+    sudo_bitboard_t bitboard;  // Bitboard to read the candidates from
+    int exp_return = ENOERR;   // Expected return value for a play
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, TEST_EASY));
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        for (int digit = 1; digit <= 9; digit++)
+        {
+            exp_return = (true == SUDO_CELLSET_HAS(bitboard.unsolved, cell)
+                          && true == SUDO_CELLSET_HAS(bitboard.digits[digit - 1], cell))
+                         ? ENOERR : EINVAL;
+            run_test_case(TEST_EASY, cell, digit, exp_return);
+        }
+    }
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Bitboard-Place_SUDO_Bitboard");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                         // Normal test cases
+    TCase *tc_error = tcase_create("Error");                           // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                     // Error test cases
+    TCase *tc_special = tcase_create("Special");                       // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_legal_play);
+    tcase_add_test(tc_normal, test_n02_legal_wrong_play);
+    tcase_add_test(tc_normal, test_n03_play_the_solution);
+    tcase_add_test(tc_error, test_e01_null_bitboard);
+    tcase_add_test(tc_error, test_e02_cell_out_of_range);
+    tcase_add_test(tc_error, test_e03_digit_out_of_range);
+    tcase_add_test(tc_error, test_e04_digit_not_a_candidate);
+    tcase_add_test(tc_error, test_e05_cell_already_solved);
+    tcase_add_test(tc_boundary, test_b01_first_and_last_cell);
+    tcase_add_test(tc_boundary, test_b02_last_empty_cell);
+    tcase_add_test(tc_special, test_s01_peers_after_a_play);
+    tcase_add_test(tc_special, test_s02_every_play);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+bool are_peers(int cell_a, int cell_b)
+{
+    // LOCAL VARIABLES
+    bool same_row = (cell_a / 9) == (cell_b / 9);  // Same row?
+    bool same_col = (cell_a % 9) == (cell_b % 9);  // Same col?
+    // Same 3x3 grid?
+    bool same_grid = (cell_a / 27) == (cell_b / 27) && (cell_a % 9) / 3 == (cell_b % 9) / 3;
+
+    // DONE
+    return cell_a != cell_b && (true == same_row || true == same_col || true == same_grid);
+}
+
+
+void run_test_case(const char test_input[81], int cell, int digit, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_bitboard_t bitboard;     // Bitboard to play on
+    sudo_bitboard_t before;       // bitboard before the play
+    bool exp_has = false;         // Should a plane hold a cell after the play?
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+    before = bitboard;
+
+    // RUN IT
+    // Call the function
+    actual_ret = place_sudo_bitboard(&bitboard, cell, digit);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "place_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // A rejected play changes nothing
+    if (ENOERR != exp_return)
+    {
+        ck_assert_msg(0 == memcmp(&bitboard, &before, sizeof(bitboard)),
+                      "A rejected play modified the bitboard");
+        return;
+    }
+    // A legal play changes just the cell and the digit's plane for its peers
+    for (int other = 0; other < SUDO_BOARD_LEN; other++)
+    {
+        exp_has = (other != cell) && SUDO_CELLSET_HAS(before.unsolved, other);
+        ck_assert_msg(exp_has == SUDO_CELLSET_HAS(bitboard.unsolved, other),
+                      "Index %d is in the wrong state in the unsolved plane", other);
+        for (int i = 1; i <= 9; i++)
+        {
+            if (other == cell)
+            {
+                exp_has = (i == digit);
+            }
+            else if (i == digit && true == are_peers(cell, other))
+            {
+                exp_has = false;
+            }
+            else
+            {
+                exp_has = SUDO_CELLSET_HAS(before.digits[i - 1], other);
+            }
+            ck_assert_msg(exp_has == SUDO_CELLSET_HAS(bitboard.digits[i - 1], other),
+                          "Digit %d is in the wrong state for index %d", i, other);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_bitboard_place_sudo_bitboard.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
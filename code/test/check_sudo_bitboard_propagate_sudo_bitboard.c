@@ -0,0 +1,442 @@
+/*
+ *  Check unit test suit for sudo_bitboard.h's propagate_sudo_bitboard() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_bitboard_propagate_sudo_bitboard.bin && \
+code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_bitboard_propagate_sudo_bitboard.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENODATA
+#include <stdbool.h>                    // bool, false, true
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_bitboard.h"              // init_sudo_bitboard(), propagate_sudo_bitboard()
+#include "sudo_cellset.h"               // is_empty_sudo_cellset()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// Take from: https://sudoku.com/easy/
+#define TEST_EASY " 683 9 7  42     11 7 5 6    5 7 12 7    158     3 74    19 2 58 162 39 9  543 1 "
+// TEST_EASY's solution
+#define TEST_EASY_SOLVED "568319472342786951197452638685974123734261589219835746473198265851627394926543817"
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Initialize a bitboard from test_input, propagate it, and check the expected return value.  On
+ *  success, check the number of plays against the cells the export filled in, and that each one
+ *  matches exp_solution (if there is one).  The board is solved if exp_solved.
+ */
+void run_test_case(const char test_input[81], const char exp_solution[81], bool exp_solved,
+                   int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Singles are enough for the easy board
+START_TEST(test_n01_easy_sudoku)
+{
+    // RUN TEST
+    run_test_case(TEST_EASY, TEST_EASY_SOLVED, true, ENOERR);
+}
+END_TEST
+
+
+// Singles stall on this one before it's solved
+START_TEST(test_n02_fixed_point)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "1    7 9 "
+                            " 3  2   8"
+                            "  96  5  "
+                            "  53  9  "
+                            " 1  8   2"
+                            "6    4   "
+                            "3      1 "
+                            " 4      7"
+                            "  7   3  " };
+    // Its solution
+    char exp_solution[81] = { "162857493"
+                              "534129678"
+                              "789643521"
+                              "475312986"
+                              "913586742"
+                              "628794135"
+                              "356478219"
+                              "241935867"
+                              "897261354" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_solution, false, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_bitboard)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    int num_plays = CANARY_INT;   // Number of plays from the tested function
+
+    // RUN TEST
+    actual_ret = propagate_sudo_bitboard(NULL, &num_plays);
+    ck_assert_msg(exp_return == actual_ret, "propagate_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+// The top-right corner needs a 9 but its col already has one
+START_TEST(test_e02_no_candidates)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "12345678 "
+                            "        9"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, false, ENODATA);
+}
+END_TEST
+
+
+// Every cell still has a candidate but the top row has nowhere left for a 1
+START_TEST(test_e03_digit_without_a_slot)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "  3456789"
+                            "         "
+                            "         "
+                            "1        "
+                            "         "
+                            "         "
+                            " 1       "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, false, ENODATA);
+}
+END_TEST
+
+
+// A legal but wrong play only shows up as a contradiction dozens of plays later
+START_TEST(test_e04_contradiction_after_plays)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;     // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    int num_plays = CANARY_INT;   // Number of plays from the tested function
+    sudo_bitboard_t bitboard;     // Bitboard to propagate
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, TEST_EASY));
+    ck_assert_int_eq(ENOERR, place_sudo_bitboard(&bitboard, 21, 2));  // The solution is a 4
+    actual_ret = propagate_sudo_bitboard(&bitboard, &num_plays);
+    ck_assert_msg(exp_return == actual_ret, "propagate_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    ck_assert_msg(num_plays > 0, "The contradiction was found after %d plays", num_plays);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_solved)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, test_input, true, ENOERR);
+}
+END_TEST
+
+
+START_TEST(test_b02_empty)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, false, ENOERR);
+}
+END_TEST
+
+
+START_TEST(test_b03_almost_solved)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "4268 3791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+    // Its solution
+    char exp_solution[81] = { "534678912"
+                              "672195348"
+                              "198342567"
+                              "859761423"
+                              "426853791"
+                              "713924856"
+                              "961537284"
+                              "287419635"
+                              "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_solution, true, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// num_plays is optional
+START_TEST(test_s01_null_num_plays)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_bitboard_t bitboard;     // Bitboard to propagate
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, TEST_EASY));
+    actual_ret = propagate_sudo_bitboard(&bitboard, NULL);
+    ck_assert_msg(exp_return == actual_ret, "propagate_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    ck_assert_msg(true == is_empty_sudo_cellset(bitboard.unsolved), "The board was not solved");
+}
+END_TEST
+
+
+// After any one legal play, the right digit never propagates to a contradiction and a wrong one
+// never propagates to anything but the solution's digits or a contradiction
+START_TEST(test_s02_every_play)
+{
+    // LOCAL VARIABLES
+    const char *solution = TEST_EASY_SOLVED;  // The easy board's solution
+    sudo_bitboard_t bitboard;                 // Bitboard to propagate
+    char board[81] = { 0 };                   // Exported board
+    int actual_ret = CANARY_INT;              // Return value of the tested function
+    int num_wrong = 0;                        // Number of wrong plays refuted
+
+    // RUN TEST
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        for (int digit = 1; digit <= 9; digit++)
+        {
+            ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, TEST_EASY));
+            if (ENOERR != place_sudo_bitboard(&bitboard, cell, digit))
+            {
+                continue;  // Not a legal play
+            }
+            actual_ret = propagate_sudo_bitboard(&bitboard, NULL);
+            if (solution[cell] == '0' + digit)
+            {
+                ck_assert_msg(ENOERR == actual_ret, "Playing the right %d at index %d returned "
+                              "[%d] '%s'", digit, cell, actual_ret, strerror(actual_ret));
+                ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+                ck_assert_msg(0 == memcmp(board, solution, SUDO_BOARD_LEN),
+                              "Playing the right %d at index %d did not solve the board",
+                              digit, cell);
+            }
+            else if (ENODATA == actual_ret)
+            {
+                num_wrong++;
+            }
+            else
+            {
+                ck_assert_msg(ENOERR == actual_ret, "Playing a wrong %d at index %d returned "
+                              "[%d] '%s'", digit, cell, actual_ret, strerror(actual_ret));
+                ck_assert_msg(false == is_empty_sudo_cellset(bitboard.unsolved),
+                              "Playing a wrong %d at index %d solved the board", digit, cell);
+            }
+        }
+    }
+    ck_assert_msg(num_wrong > 0, "No wrong play was refuted");
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Bitboard-Propagate_SUDO_Bitboard");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                             // Normal test cases
+    TCase *tc_error = tcase_create("Error");                               // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                         // Error test cases
+    TCase *tc_special = tcase_create("Special");                           // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_easy_sudoku);
+    tcase_add_test(tc_normal, test_n02_fixed_point);
+    tcase_add_test(tc_error, test_e01_null_bitboard);
+    tcase_add_test(tc_error, test_e02_no_candidates);
+    tcase_add_test(tc_error, test_e03_digit_without_a_slot);
+    tcase_add_test(tc_error, test_e04_contradiction_after_plays);
+    tcase_add_test(tc_boundary, test_b01_solved);
+    tcase_add_test(tc_boundary, test_b02_empty);
+    tcase_add_test(tc_boundary, test_b03_almost_solved);
+    tcase_add_test(tc_special, test_s01_null_num_plays);
+    tcase_add_test(tc_special, test_s02_every_play);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void run_test_case(const char test_input[81], const char exp_solution[81], bool exp_solved,
+                   int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    int num_plays = CANARY_INT;   // Number of plays from the tested function
+    int num_filled = 0;           // Number of cells propagation filled in
+    sudo_bitboard_t bitboard;     // Bitboard to propagate
+    char board[81] = { 0 };       // Exported board
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_bitboard(&bitboard, test_input));
+
+    // RUN IT
+    // Call the function
+    actual_ret = propagate_sudo_bitboard(&bitboard, &num_plays);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "propagate_sudo_bitboard() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    if (ENOERR != exp_return)
+    {
+        return;  // Nothing to check
+    }
+    // Check the plays
+    ck_assert_int_eq(ENOERR, export_sudo_bitboard(&bitboard, board));
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        if (SUDO_EMPTY_GRID != test_input[cell])
+        {
+            ck_assert_msg(test_input[cell] == board[cell], "The given at index %d changed", cell);
+        }
+        else if (SUDO_EMPTY_GRID != board[cell])
+        {
+            num_filled++;
+            ck_assert_msg(NULL == exp_solution || exp_solution[cell] == board[cell],
+                          "Index %d was filled in with a %c instead of a %c", cell, board[cell],
+                          exp_solution[cell]);
+        }
+    }
+    ck_assert_msg(num_filled == num_plays, "propagate_sudo_bitboard() counted %d plays but "
+                  "filled in %d cells", num_plays, num_filled);
+    ck_assert_msg(exp_solved == is_empty_sudo_cellset(bitboard.unsolved),
+                  "The board was %s", (true == exp_solved) ? "not solved" : "solved");
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_bitboard_propagate_sudo_bitboard.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,568 @@
+/*
+ *  Check unit test suit for sudo_dlx.h's enumerate_dlx_solutions() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_dlx_enumerate_dlx_solutions.bin && \
+code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_dlx_enumerate_dlx_solutions.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENODATA
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_dlx.h"                   // enumerate_dlx_solutions()
+#include "sudo_logic.h"                 // is_game_over()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// The most solutions test_callback() records
+#define TEST_MAX_SOLUTIONS 10
+
+/*
+ *  The context test_callback() is given.
+ */
+typedef struct
+{
+    int stop_after;                          // Stop enumerating after this many calls
+    int num_calls;                           // Number of times the callback was called
+    char solutions[TEST_MAX_SOLUTIONS][81];  // The first solutions the callback was given
+} test_context_t;
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Make the function call with test_callback(), stopping after stop_after solutions, and check
+ *  the expected return value and solution count.  Validate the recorded solutions: each one must
+ *  be a solved board that keeps test_input's givens, and no two may match.  Also verify
+ *  test_input was not modified.
+ */
+void run_test_case(char test_input[81], int stop_after, int exp_count, int exp_return);
+
+/*
+ *  Record the solution in context and stop once context->stop_after solutions have been seen.
+ */
+int test_callback(const char solution[81], void *context);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Take from: https://sudoku.com/easy/
+START_TEST(test_n01_easy_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;              // Expected return value for this test case
+    int exp_count = 1;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_n02_multiple_solutions)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;              // Expected return value for this test case
+    int exp_count = 3;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        5"
+                            "5 93   2 "
+                            "     739 "
+                            "  325814 "
+                            "6 5173  2"
+                            "182 9  37"
+                            "8 4    7 "
+                            "2 7  5461"
+                            "31 7   5 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+// The top-right corner needs a 9 but its col already has one
+START_TEST(test_n03_no_solution)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;              // Expected return value for this test case
+    int exp_count = 0;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "12345678 "
+                            "        9"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_invalid_char_zero)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;              // Expected return value for this test case
+    int exp_count = 0;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 10" };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e02_bad_pointer)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;              // Expected return value for this test case
+    int exp_count = 0;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char *test_input = NULL;
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e03_duplicate_givens)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;              // Expected return value for this test case
+    int exp_count = 0;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 76"
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_null_callback)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    actual_ret = enumerate_dlx_solutions(test_input, NULL, NULL, NULL);
+    ck_assert_msg(exp_return == actual_ret, "enumerate_dlx_solutions() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;              // Expected return value for this test case
+    int exp_count = 1;                    // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+// Stop on the very first solution
+START_TEST(test_b02_stop_after_one)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 1;        // Expected solution count for this test case
+    int stop_after = 1;       // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        5"
+                            "5 93   2 "
+                            "     739 "
+                            "  325814 "
+                            "6 5173  2"
+                            "182 9  37"
+                            "8 4    7 "
+                            "2 7  5461"
+                            "31 7   5 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+// Stop on the last solution there is
+START_TEST(test_b03_stop_after_last)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 3;        // Expected solution count for this test case
+    int stop_after = 3;       // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        5"
+                            "5 93   2 "
+                            "     739 "
+                            "  325814 "
+                            "6 5173  2"
+                            "182 9  37"
+                            "8 4    7 "
+                            "2 7  5461"
+                            "31 7   5 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// The empty board has billions of solutions so only the callback can stop this
+START_TEST(test_s01_callback_early_stop)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;              // Expected return value for this test case
+    int exp_count = TEST_MAX_SOLUTIONS;   // Expected solution count for this test case
+    int stop_after = TEST_MAX_SOLUTIONS;  // Stop after this many solutions
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, stop_after, exp_count, exp_return);
+}
+END_TEST
+
+
+// num_solutions is optional
+START_TEST(test_s02_null_num_solutions)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;         // Expected return value for this test case
+    int exp_count = 3;               // Expected solution count for this test case
+    int actual_ret = CANARY_INT;     // Return value of the tested function
+    test_context_t context = { 0 };  // Context for the callback
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        5"
+                            "5 93   2 "
+                            "     739 "
+                            "  325814 "
+                            "6 5173  2"
+                            "182 9  37"
+                            "8 4    7 "
+                            "2 7  5461"
+                            "31 7   5 " };
+
+    // RUN TEST
+    context.stop_after = TEST_MAX_SOLUTIONS;
+    actual_ret = enumerate_dlx_solutions(test_input, test_callback, &context, NULL);
+    ck_assert_msg(exp_return == actual_ret, "enumerate_dlx_solutions() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    ck_assert_msg(exp_count == context.num_calls, "The callback was called %d times instead of "
+                  "%d\n", context.num_calls, exp_count);
+}
+END_TEST
+
+
+// The arena is shared between calls, so rejected, exhausted, and cut-short searches must all leave
+// it ready for the next board
+START_TEST(test_s03_arena_reuse)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle with three solutions
+    char multiple_input[81] = { "        5"
+                                "5 93   2 "
+                                "     739 "
+                                "  325814 "
+                                "6 5173  2"
+                                "182 9  37"
+                                "8 4    7 "
+                                "2 7  5461"
+                                "31 7   5 " };
+    // The sudoku puzzle with duplicate givens
+    char dupe_input[81] = { " 683 9 76"
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+    // The sudoku puzzle with no solution
+    char no_solution_input[81] = { "12345678 "
+                                   "        9"
+                                   "         "
+                                   "         "
+                                   "         "
+                                   "         "
+                                   "         "
+                                   "         "
+                                   "         " };
+    // The empty sudoku puzzle
+    char empty_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(multiple_input, TEST_MAX_SOLUTIONS, 3, ENOERR);
+    run_test_case(dupe_input, TEST_MAX_SOLUTIONS, 0, EINVAL);
+    run_test_case(multiple_input, TEST_MAX_SOLUTIONS, 3, ENOERR);
+    run_test_case(no_solution_input, TEST_MAX_SOLUTIONS, 0, ENOERR);
+    run_test_case(multiple_input, TEST_MAX_SOLUTIONS, 3, ENOERR);
+    run_test_case(empty_input, 2, 2, ENOERR);
+    run_test_case(multiple_input, TEST_MAX_SOLUTIONS, 3, ENOERR);
+    run_test_case(multiple_input, 2, 2, ENOERR);
+    run_test_case(multiple_input, TEST_MAX_SOLUTIONS, 3, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_DLX-Enumerate_DLX_Solutions");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                        // Normal test cases
+    TCase *tc_error = tcase_create("Error");                          // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                    // Error test cases
+    TCase *tc_special = tcase_create("Special");                      // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_easy_sudoku);
+    tcase_add_test(tc_normal, test_n02_multiple_solutions);
+    tcase_add_test(tc_normal, test_n03_no_solution);
+    tcase_add_test(tc_error, test_e01_invalid_char_zero);
+    tcase_add_test(tc_error, test_e02_bad_pointer);
+    tcase_add_test(tc_error, test_e03_duplicate_givens);
+    tcase_add_test(tc_error, test_e04_null_callback);
+    tcase_add_test(tc_boundary, test_b01_solved);
+    tcase_add_test(tc_boundary, test_b02_stop_after_one);
+    tcase_add_test(tc_boundary, test_b03_stop_after_last);
+    tcase_add_test(tc_special, test_s01_callback_early_stop);
+    tcase_add_test(tc_special, test_s02_null_num_solutions);
+    tcase_add_test(tc_special, test_s03_arena_reuse);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void run_test_case(char test_input[81], int stop_after, int exp_count, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;     // Return value of the tested function
+    int actual_count = CANARY_INT;   // Solution count from the tested function
+    test_context_t context = { 0 };  // Context for the callback
+    char original[81] = { 0 };       // Copy of test_input before the call
+
+    // SETUP
+    context.stop_after = stop_after;
+    if (NULL != test_input)
+    {
+        memcpy(original, test_input, SUDO_BOARD_LEN * sizeof(original[0]));
+    }
+
+    // RUN IT
+    // Call the function
+    actual_ret = enumerate_dlx_solutions(test_input, test_callback, &context, &actual_count);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "enumerate_dlx_solutions() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Compare the counts
+    ck_assert_msg(exp_count == context.num_calls, "The callback was called %d times instead of "
+                  "%d\n", context.num_calls, exp_count);
+    if (ENOERR == exp_return)
+    {
+        ck_assert_msg(exp_count == actual_count, "enumerate_dlx_solutions() counted %d instead "
+                      "of %d\n", actual_count, exp_count);
+    }
+    // The board is untouched
+    if (NULL != test_input)
+    {
+        ck_assert_msg(0 == memcmp(test_input, original, SUDO_BOARD_LEN * sizeof(original[0])),
+                      "enumerate_dlx_solutions() modified test_input");
+    }
+    // Check every recorded solution
+    for (int i = 0; i < context.num_calls && i < TEST_MAX_SOLUTIONS; i++)
+    {
+        ck_assert_msg(ENOERR == is_game_over(context.solutions[i]),
+                      "Solution %d is not a solved game board", i);
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            ck_assert_msg(SUDO_EMPTY_GRID == test_input[cell]
+                          || test_input[cell] == context.solutions[i][cell],
+                          "Solution %d changed the given at index %d", i, cell);
+        }
+        for (int j = 0; j < i; j++)
+        {
+            ck_assert_msg(0 != memcmp(context.solutions[i], context.solutions[j],
+                                      SUDO_BOARD_LEN),
+                          "Solutions %d and %d are the same solution", j, i);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+int test_callback(const char solution[81], void *context)
+{
+    // LOCAL VARIABLES
+    int results = ENOERR;                    // Keep enumerating
+    test_context_t *test_context = context;  // The test case's context
+
+    // RECORD IT
+    if (test_context->num_calls < TEST_MAX_SOLUTIONS)
+    {
+        memcpy(test_context->solutions[test_context->num_calls], solution, SUDO_BOARD_LEN);
+    }
+    test_context->num_calls++;
+
+    // STOP?
+    if (test_context->num_calls >= test_context->stop_after)
+    {
+        results = ENODATA;  // That's enough
+    }
+
+    // DONE
+    return results;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_dlx_enumerate_dlx_solutions.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,433 @@
+/*
+ *  Check unit test suit for sudo_enum.h's iterator: init_sudo_enum(), next_sudo_enum(), and
+ *  destroy_sudo_enum().
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_enum_next_sudo_enum.bin && \
+code/dist/check_sudo_enum_next_sudo_enum.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_enum_next_sudo_enum.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_enum_next_sudo_enum.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_enum_next_sudo_enum.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_enum_next_sudo_enum.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_enum_next_sudo_enum.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENODATA
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_enum.h"                  // sudo_enum_t, init_sudo_enum(), next_sudo_enum()
+#include "sudo_logic.h"                 // is_game_over()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// Stop streaming an under-constrained board after this many solutions
+#define TEST_MAX_STREAM 10000
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Initialize an enumerator, check the expected return value, and then stream up to max_count
+ *  solutions.  Each one must be a solved board that keeps test_input's givens and differs from
+ *  the one before it.  Check the number streamed and, if the enumerator ran dry, that it stays
+ *  dry.
+ */
+void run_test_case(char test_input[81], int max_count, int exp_count, int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Take from: https://sudoku.com/easy/
+START_TEST(test_n01_easy_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 1;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+// Take from: https://sudoku.com/extreme/
+START_TEST(test_n02_extreme_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 1;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_n03_multiple_solutions)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 3;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        5"
+                            "5 93   2 "
+                            "     739 "
+                            "  325814 "
+                            "6 5173  2"
+                            "182 9  37"
+                            "8 4    7 "
+                            "2 7  5461"
+                            "31 7   5 " };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_invalid_char_letter)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    int exp_count = 0;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1a" };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e02_bad_pointer)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    int exp_count = 0;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char *test_input = NULL;
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e03_invalid_board_grid_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    int exp_count = 0;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 5   3   "
+                            "9 6    78"
+                            "3   28  1"
+                            "        7"
+                            " 136 298 "
+                            "8 2    1 "
+                            "  91   6 "     // <-- COL 8 HERE...
+                            "28       "
+                            "7 52   96" };  // <-- ...AND COL 9 HERE
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_null_arguments)
+{
+    // LOCAL VARIABLES
+    sudo_enum_t iter;           // Enumerator for this test case
+    char solution[81] = { 0 };  // A solution
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    ck_assert_int_eq(EINVAL, init_sudo_enum(NULL, test_input));
+    ck_assert_int_eq(ENOERR, init_sudo_enum(&iter, test_input));
+    ck_assert_int_eq(EINVAL, next_sudo_enum(NULL, solution));
+    ck_assert_int_eq(EINVAL, next_sudo_enum(&iter, NULL));
+    ck_assert_int_eq(EINVAL, destroy_sudo_enum(NULL));
+    ck_assert_int_eq(ENOERR, destroy_sudo_enum(&iter));
+    ck_assert_int_eq(ENODATA, next_sudo_enum(&iter, solution));  // Destroyed
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 1;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_b02_almost_empty)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;          // Expected return value for this test case
+    int exp_count = TEST_MAX_STREAM;  // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                        5                                        " };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_b03_empty)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;          // Expected return value for this test case
+    int exp_count = TEST_MAX_STREAM;  // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// The top-right corner needs a 9 but its col already has one
+START_TEST(test_s01_no_solution)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    int exp_count = 0;        // Expected number of solutions for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "12345678 "
+                            "        9"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, TEST_MAX_STREAM, exp_count, exp_return);
+}
+END_TEST
+
+
+// Solutions come out in the same order every time
+START_TEST(test_s02_restart)
+{
+    // LOCAL VARIABLES
+    sudo_enum_t iter;           // Enumerator for this test case
+    char first[81] = { 0 };     // First solution of the first pass
+    char solution[81] = { 0 };  // First solution of the second pass
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_enum(&iter, test_input));
+    ck_assert_int_eq(ENOERR, next_sudo_enum(&iter, first));
+    ck_assert_int_eq(ENOERR, next_sudo_enum(&iter, solution));
+    ck_assert_int_eq(ENOERR, destroy_sudo_enum(&iter));
+    ck_assert_int_eq(ENOERR, init_sudo_enum(&iter, test_input));
+    ck_assert_int_eq(ENOERR, next_sudo_enum(&iter, solution));
+    ck_assert_msg(0 == memcmp(first, solution, SUDO_BOARD_LEN), "The first solution changed");
+    ck_assert_int_eq(ENOERR, destroy_sudo_enum(&iter));
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Enum-Next_Sudo_Enum");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                // Normal test cases
+    TCase *tc_error = tcase_create("Error");                  // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");            // Error test cases
+    TCase *tc_special = tcase_create("Special");              // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_easy_sudoku);
+    tcase_add_test(tc_normal, test_n02_extreme_sudoku);
+    tcase_add_test(tc_normal, test_n03_multiple_solutions);
+    tcase_add_test(tc_error, test_e01_invalid_char_letter);
+    tcase_add_test(tc_error, test_e02_bad_pointer);
+    tcase_add_test(tc_error, test_e03_invalid_board_grid_dupe);
+    tcase_add_test(tc_error, test_e04_null_arguments);
+    tcase_add_test(tc_boundary, test_b01_solved);
+    tcase_add_test(tc_boundary, test_b02_almost_empty);
+    tcase_add_test(tc_boundary, test_b03_empty);
+    tcase_add_test(tc_special, test_s01_no_solution);
+    tcase_add_test(tc_special, test_s02_restart);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void run_test_case(char test_input[81], int max_count, int exp_count, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    int actual_count = 0;         // Number of solutions streamed
+    sudo_enum_t iter;             // Enumerator under test
+    char solution[81] = { 0 };    // The latest solution
+    char previous[81] = { 0 };    // The solution before it
+
+    // RUN IT
+    // Call the function
+    actual_ret = init_sudo_enum(&iter, test_input);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "init_sudo_enum() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    if (ENOERR == exp_return)
+    {
+        // Stream the solutions
+        while (actual_count < max_count && ENOERR == (actual_ret = next_sudo_enum(&iter, solution)))
+        {
+            ck_assert_msg(ENOERR == is_game_over(solution),
+                          "Solution %d is not a solved game board", actual_count);
+            for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+            {
+                ck_assert_msg(SUDO_EMPTY_GRID == test_input[cell]
+                              || test_input[cell] == solution[cell],
+                              "Solution %d changed the given at index %d", actual_count, cell);
+            }
+            ck_assert_msg(0 != memcmp(solution, previous, SUDO_BOARD_LEN),
+                          "Solution %d repeats the one before it", actual_count);
+            memcpy(previous, solution, SUDO_BOARD_LEN);
+            actual_count++;
+        }
+        // Compare the count
+        ck_assert_msg(exp_count == actual_count, "next_sudo_enum() streamed %d solutions "
+                      "instead of %d\n", actual_count, exp_count);
+        if (actual_count < max_count)
+        {
+            ck_assert_msg(ENODATA == actual_ret, "next_sudo_enum() returned [%d] '%s' "
+                          "instead of running dry\n", actual_ret, strerror(actual_ret));
+            ck_assert_int_eq(ENODATA, next_sudo_enum(&iter, solution));  // Stays dry
+        }
+        ck_assert_int_eq(ENOERR, destroy_sudo_enum(&iter));
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_enum_next_sudo_enum.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
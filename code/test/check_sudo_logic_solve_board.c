@@ -197,7 +197,7 @@ END_TEST
 
 
 // Taken from: https://sandiway.arizona.edu/sudoku/examples.html
-// Manually execute this test case: ./code/dist/sum_dock.bin "   26 7 168  7  9 19   45  82 1   4   46 29   5   3 23  93   74 4  5  367 3 18   "
+// Manually execute this test case: ./code/dist/sum_dock.bin "   26 7 168  7  9 19   45  82 1   4   46 29   5   3 28  93   74 4  5  367 3 18   "
 START_TEST(test_n07_easiest_puzzle_1)
 {
     // LOCAL VARIABLES
@@ -210,7 +210,7 @@ START_TEST(test_n07_easiest_puzzle_1)
                             "19   45  "
                             "82 1   4 "
                             "  46 29  "
-                            " 5   3 23"
+                            " 5   3 28"
                             "  93   74"
                             " 4  5  36"
                             "7 3 18   " };
@@ -278,17 +278,17 @@ START_TEST(test_n10_difficult_puzzle_1)
     // LOCAL VARIABLES
     int exp_return = ENOERR;  // Expected return value for this test case
     // Expected results for this test case
-    char *exp_result = "581572439792843651364591782438957216256184973179326845845219367913768524627435198";
+    char *exp_result = "581672439792843651364591782438957216256184973179326845845219367913768524627435198";
     // The sudoku puzzle for this test case
-    char test_input[81] = { " 2 6 8   "
-                            "58   97  "
-                            "    4    "
-                            "37    5  "
-                            "6       4"
-                            "  8    13"
-                            "    2    "
-                            "  98   36"
-                            "   3 6 9 " };
+    char test_input[81] = { "   6  4  "
+                            "7    36  "
+                            "    91 8 "
+                            "         "
+                            " 5 18   3"
+                            "   3 6 45"
+                            " 4 2   6 "
+                            "9 3      "
+                            " 2    1  " };
 
     // RUN TEST
     run_test_case(test_input, exp_result, exp_return);
@@ -595,9 +595,8 @@ END_TEST
 START_TEST(test_b03_almost_empty)
 {
     // LOCAL VARIABLES
-    int exp_return = ENODATA;  // Expected return value for this test case
-    // Expected results for this test case
-    char *exp_result = "                                        5                                        ";
+    int exp_return = ENOERR;  // Expected return value for this test case
+    char *exp_result = NULL;  // Expected results for this test case
     // The sudoku puzzle for this test case
     char test_input[81] = { "                                        5                                        " };
 
@@ -610,9 +609,8 @@ END_TEST
 START_TEST(test_b04_empty)
 {
     // LOCAL VARIABLES
-    int exp_return = ENODATA;  // Expected return value for this test case
-    // Expected results for this test case
-    char *exp_result = "                                                                                 ";
+    int exp_return = ENOERR;  // Expected return value for this test case
+    char *exp_result = NULL;  // Expected results for this test case
     // The sudoku puzzle for this test case
     char test_input[81] = { "                                                                                 " };
 
@@ -697,6 +695,29 @@ START_TEST(test_s03_long_array_truncated)
 END_TEST
 
 
+// The top-right corner needs a 9 but its col already has one
+START_TEST(test_s04_no_solution)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;  // Expected return value for this test case
+    char *exp_result = NULL;   // Expected results for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "12345678 "
+                            "        9"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_result, exp_return);
+}
+END_TEST
+
+
 /**************************************************************************************************/
 /************************************* HELPER CODE DEFINITION *************************************/
 /**************************************************************************************************/
@@ -740,6 +761,7 @@ Suite *create_test_suite(void)
     tcase_add_test(tc_special, test_s01_multiple_solutions);
     tcase_add_test(tc_special, test_s02_array_too_long);
     tcase_add_test(tc_special, test_s03_long_array_truncated);
+    tcase_add_test(tc_special, test_s04_no_solution);
     suite_add_tcase(suite, tc_normal);
     suite_add_tcase(suite, tc_error);
     suite_add_tcase(suite, tc_boundary);
@@ -0,0 +1,1128 @@
+/*
+ *  Check unit test suit for sudo_logic.h's solve_board_opts() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_logic_solve_board_opts.bin && \
+code/dist/check_sudo_logic_solve_board_opts.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_logic_solve_board_opts.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_logic_solve_board_opts.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_logic_solve_board_opts.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_logic_solve_board_opts.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_logic_solve_board_opts.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENODATA
+#include <pthread.h>                    // pthread_create(), pthread_join()
+#include <stdint.h>                     // UINT64_MAX, uint64_t
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_chains.h"                // sudo_chain_counters_t
+#include "sudo_logic.h"                 // init_sudo_options(), is_game_over(), solve_board_opts()
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "sudo_profile.h"               // init_sudo_profile(), sudo_profile_t
+#include "sudo_search.h"                // SUDO_RESTART_GEOMETRIC, SUDO_RESTART_LUBY
+#include "sudo_ttable.h"                // create_sudo_ttable(), destroy_sudo_ttable()
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+
+// Number of threads solving at once
+#define TEST_NUM_THREADS 4
+
+// Boards the search has to work at once the pipeline is cut down to the singles, and that take
+// the SAT engine the most conflicts
+const char *test_search_boards[] = {
+    "1    7 9  3  2   8  96  5    53  9   1  8   26    4   3      1  4      7  7   3  ",
+    "              3 85  1 2       5 7     4   1   9       5      73  2 1        4   9",
+    "8          36      7  9 2   5   7       457     1   3   1    68  85   1  9    4  ",
+    "       79  4         67 5  9   81       397 6 7       3 2   6  56      3   8    4",
+    "1       2 9 4   5   6   7   5 9 3       7       85  4 7     6   3   9 8   2     1",
+};
+
+// Valid boards without a solution
+const char *test_unsat_boards[] = {
+    "12345678         9                                                               ",
+    "1    7 9  3  2   8  96  5    53  9   1  8   26    4   3      1  4      7  7   3 9",
+};
+
+// Randomized restart schedules
+const sudo_restart_t test_restarts[] = { SUDO_RESTART_LUBY, SUDO_RESTART_GEOMETRIC };
+
+// Seeds for the randomized restart schedules
+const uint64_t test_seeds[] = { 0, 1, 0x5EED, UINT64_MAX };
+
+// Boards that stall after the subsets and need a fish of size 2 (X-Wing), 3 (Swordfish), and 4
+// (Jellyfish), in that order
+const char *test_fish_boards[] = {
+    "2    9 5   42     1 8     7   6 5       4 39   5   8  4  3               924   68",
+    " 691 5  78    3     19     5 7 2 1 6   5  4   4     8 6   7   2 82    91         ",
+    "42  9       1 4    7    3    9    61     1    3 5   4     734  6  9   7 2  6   3 ",
+};
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Make the function call on a copy of test_input and check the expected return value.  On
+ *  success, the copy must be a solved board that keeps test_input's givens.
+ */
+void run_test_case(const char test_input[81], const sudo_options_t *options, int exp_return);
+
+/*
+ *  Cut options down to the naked and hidden singles so the search does the rest, and randomize
+ *  it with Luby restarts.
+ */
+void search_only(sudo_options_t *options);
+
+/*
+ *  Cut options down to the singles, locked candidates, and subsets followed by strategy, with
+ *  the search fallback off, so the board only gets solved if strategy makes progress.
+ */
+void subsets_then(sudo_options_t *options, sudo_strategy_id_t strategy);
+
+/*
+ *  Thread entry point: solve every test_search_boards entry with the options passed in.
+ */
+void *solve_search_boards(void *options);
+
+/*
+ *  Run solve_search_boards() with options on TEST_NUM_THREADS threads at once.
+ */
+void run_thread_case(const sudo_options_t *options);
+
+/*
+ *  Solve a copy of test_input with options, counting the search nodes it visits.
+ *
+ *  Args:
+ *      test_input: The board to solve.
+ *      options: The solver options.  Their search_nodes is ignored.
+ *      board: [Out] The solved copy of test_input.
+ *      num_nodes: [Out] The number of search nodes visited.
+ *
+ *  Returns:
+ *      solve_board_opts()'s return value.
+ */
+int solve_counting_nodes(const char test_input[81], const sudo_options_t *options,
+                         char board[81], uint64_t *num_nodes);
+
+/*
+ *  Solve every test_search_boards and test_unsat_boards entry with SUDO_RESTART_NONE and then
+ *  with each randomized schedule, using restart_base and every test seed, and check that they
+ *  all return the same results and solutions.
+ */
+void run_restart_case(int restart_base);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Take from: https://sudoku.com/extreme/
+START_TEST(test_n01_default_options)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    run_test_case(test_input, &options, exp_return);
+    run_test_case(test_input, NULL, exp_return);  // NULL means the defaults
+}
+END_TEST
+
+
+START_TEST(test_n02_sat_engine)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    for (int i = 0; i < sizeof(test_search_boards) / sizeof(test_search_boards[0]); i++)
+    {
+        run_test_case(test_search_boards[i], &options, exp_return);
+    }
+}
+END_TEST
+
+
+// Randomized restarts solve (and refute) the same boards as the deterministic search
+START_TEST(test_n03_restart_schedules)
+{
+    // RUN TEST
+    run_restart_case(SUDO_RESTART_BASE);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_bad_pointer)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    run_test_case(NULL, &options, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e02_bad_options)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.fish_size = 5;  // There is no fish bigger than a Jellyfish
+    run_test_case(test_input, &options, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e03_ttable_without_slots)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;       // Expected return value for this test case
+    sudo_options_t options;        // Options for this test case
+    sudo_ttable_t ttable = { 0 };  // Never created
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.ttable = &ttable;
+    run_test_case(test_input, &options, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_sat_invalid_board)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 76"
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    run_test_case(test_input, &options, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e05_sat_negative_budget)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    options.sat_max_learned = -1;
+    run_test_case(test_search_boards[0], &options, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// The easy board never reaches the chain strategy, so its counters stay zeroed
+START_TEST(test_b01_chain_counters_unused)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                 // Expected return value for this test case
+    sudo_options_t options;                  // Options for this test case
+    sudo_chain_counters_t counters = { 0 };  // Chain totals for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.chain_counters = &counters;
+    run_test_case(test_input, &options, exp_return);
+    ck_assert_int_eq(0, counters.calls);
+    ck_assert_int_eq(0, counters.coloring_elims + counters.xchain_elims);
+}
+END_TEST
+
+
+START_TEST(test_b02_sat_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    run_test_case(test_input, &options, exp_return);
+}
+END_TEST
+
+
+// Singles solve the easy board, so the search never runs
+START_TEST(test_b03_search_nodes_unused)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+    uint64_t num_nodes = 0;  // Search nodes visited
+    char board[81] = { 0 };  // Solved board
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    search_only(&options);
+    ck_assert_int_eq(ENOERR, solve_counting_nodes(test_input, &options, board, &num_nodes));
+    ck_assert_int_eq(0, num_nodes);
+}
+END_TEST
+
+
+// Every run gets a single node before the first restart, so nearly every run restarts
+START_TEST(test_b04_restart_base_one)
+{
+    // RUN TEST
+    run_restart_case(1);
+}
+END_TEST
+
+
+START_TEST(test_b05_template_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    sudo_options_t options;   // Options for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "534678912"
+                            "672195348"
+                            "198342567"
+                            "859761423"
+                            "426853791"
+                            "713924856"
+                            "961537284"
+                            "287419635"
+                            "345286179" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_TEMPLATE;
+    options.search = false;
+    run_test_case(test_input, &options, exp_return);
+}
+END_TEST
+
+
+// A fish_size of 0 turns the strategy off, even for an X-Wing
+START_TEST(test_b06_fish_disabled)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+
+    // RUN TEST
+    subsets_then(&options, SUDO_STRATEGY_FISH);
+    options.fish_size = 0;
+    run_test_case(test_fish_boards[0], &options, ENODATA);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// The pipeline has to fall back on simple coloring for this board
+START_TEST(test_s01_chain_counters_coloring)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                 // Expected return value for this test case
+    sudo_options_t options;                  // Options for this test case
+    sudo_chain_counters_t counters = { 0 };  // Chain totals for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "1 6  4 7 "
+                            "  9 1   3"
+                            " 3 9     "
+                            "    9  8 "
+                            " 5    6  "
+                            "9 1 8  5 "
+                            "  4  1  7"
+                            "   2  1 8"
+                            "   8   64" };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.search = false;
+    options.chain_counters = &counters;
+    run_test_case(test_input, &options, exp_return);
+    ck_assert_int_gt(counters.calls, 0);
+    ck_assert_int_gt(counters.coloring_elims, 0);
+}
+END_TEST
+
+
+// The pipeline has to fall back on an X-Chain for this board
+START_TEST(test_s02_chain_counters_xchain)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;                 // Expected return value for this test case
+    sudo_options_t options;                  // Options for this test case
+    sudo_chain_counters_t counters = { 0 };  // Chain totals for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "   3  5 6"
+                            "         "
+                            " 794 8   "
+                            " 8   6   "
+                            "   92   8"
+                            "69 5   2 "
+                            "1 3    69"
+                            "4     7  "
+                            " 2    3  " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.search = false;
+    options.chain_counters = &counters;
+    run_test_case(test_input, &options, exp_return);
+    ck_assert_int_gt(counters.calls, 0);
+    ck_assert_int_gt(counters.xchain_elims, 0);
+    ck_assert_int_gt(counters.nodes_visited, 0);
+}
+END_TEST
+
+
+// The counters are running totals: a second solve adds the same amounts again
+START_TEST(test_s03_chain_counters_accumulate)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;                  // Options for this test case
+    sudo_chain_counters_t counters = { 0 };  // Chain totals for this test case
+    sudo_chain_counters_t first = { 0 };     // Chain totals after the first solve
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "   3  5 6"
+                            "         "
+                            " 794 8   "
+                            " 8   6   "
+                            "   92   8"
+                            "69 5   2 "
+                            "1 3    69"
+                            "4     7  "
+                            " 2    3  " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.chain_counters = &counters;
+    run_test_case(test_input, &options, ENOERR);
+    first = counters;
+    run_test_case(test_input, &options, ENOERR);
+    ck_assert_int_eq(2 * first.calls, counters.calls);
+    ck_assert_int_eq(2 * first.coloring_elims, counters.coloring_elims);
+    ck_assert_int_eq(2 * first.xchain_elims, counters.xchain_elims);
+    ck_assert_int_eq(2 * first.nodes_visited, counters.nodes_visited);
+}
+END_TEST
+
+
+// Solves that share a table learn from each other, and what they learn stays sound
+START_TEST(test_s04_shared_ttable)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;        // Options for this test case
+    sudo_ttable_t ttable = { 0 };  // Shared by every solve
+    // The top-right corner needs a 9 but its col already has one
+    char no_solution[81] = { "12345678 "
+                             "        9"
+                             "         "
+                             "         "
+                             "         "
+                             "         "
+                             "         "
+                             "         "
+                             "         " };
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, create_sudo_ttable(&ttable, SUDO_TTABLE_LEN));
+    search_only(&options);
+    options.ttable = &ttable;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        solve_search_boards(&options);
+        run_test_case(no_solution, &options, ENODATA);
+    }
+    ck_assert_int_eq(ENOERR, destroy_sudo_ttable(&ttable));
+}
+END_TEST
+
+
+// Solves on several threads at once can share one table
+START_TEST(test_s05_shared_ttable_threads)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;        // Options for this test case
+    sudo_ttable_t ttable = { 0 };  // Shared by every thread
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, create_sudo_ttable(&ttable, SUDO_TTABLE_LEN));
+    search_only(&options);
+    options.ttable = &ttable;
+    run_thread_case(&options);
+    ck_assert_int_eq(ENOERR, destroy_sudo_ttable(&ttable));
+}
+END_TEST
+
+
+// The first board fails on its givens alone but the second takes dozens of conflicts to refute
+START_TEST(test_s06_sat_unsatisfiable)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENODATA;  // Expected return value for this test case
+    sudo_options_t options;    // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    for (int i = 0; i < sizeof(test_unsat_boards) / sizeof(test_unsat_boards[0]); i++)
+    {
+        run_test_case(test_unsat_boards[i], &options, exp_return);
+    }
+}
+END_TEST
+
+
+// A budget this small fills up with learned clauses within a few conflicts, so every board goes
+// through the reset that forgets them and carries on from the level zero facts
+START_TEST(test_s07_sat_clause_arena_full)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    for (int budget = 1; budget <= 4; budget++)
+    {
+        options.sat_max_learned = budget;
+        for (int i = 0; i < sizeof(test_search_boards) / sizeof(test_search_boards[0]); i++)
+        {
+            run_test_case(test_search_boards[i], &options, ENOERR);
+        }
+    }
+    options.sat_max_learned = 4;
+    for (int i = 0; i < sizeof(test_unsat_boards) / sizeof(test_unsat_boards[0]); i++)
+    {
+        run_test_case(test_unsat_boards[i], &options, ENODATA);
+    }
+}
+END_TEST
+
+
+// The same seed makes the same choices: the same result, solution, and node count every time
+START_TEST(test_s08_seed_reproducible)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;            // Options for this test case
+    int first_ret = CANARY_INT;        // Return value of the first solve
+    int second_ret = CANARY_INT;       // Return value of the second solve
+    char first_board[81] = { 0 };      // Board from the first solve
+    char second_board[81] = { 0 };     // Board from the second solve
+    uint64_t first_nodes = 0;          // Search nodes the first solve visited
+    uint64_t second_nodes = 0;         // Search nodes the second solve visited
+    uint64_t total_nodes = 0;          // Search nodes counted over both solves
+    uint64_t max_nodes = 0;            // Most search nodes any one solve visited
+    const char *test_input = NULL;     // Board to solve
+
+    // RUN TEST
+    search_only(&options);
+    for (int r = 0; r < sizeof(test_restarts) / sizeof(test_restarts[0]); r++)
+    {
+        options.restart = test_restarts[r];
+        for (int s = 0; s < sizeof(test_seeds) / sizeof(test_seeds[0]); s++)
+        {
+            options.seed = test_seeds[s];
+            for (int i = 0; i < sizeof(test_search_boards) / sizeof(test_search_boards[0]); i++)
+            {
+                test_input = test_search_boards[i];
+                first_ret = solve_counting_nodes(test_input, &options, first_board, &first_nodes);
+                second_ret = solve_counting_nodes(test_input, &options, second_board,
+                                                  &second_nodes);
+                ck_assert_msg(first_ret == second_ret, "Seed %#lx returned [%d] '%s' and then "
+                              "[%d] '%s' on board %d", (unsigned long)options.seed, first_ret,
+                              strerror(first_ret), second_ret, strerror(second_ret), i);
+                ck_assert_msg(0 == memcmp(first_board, second_board, SUDO_BOARD_LEN),
+                              "Seed %#lx solved board %d two ways", (unsigned long)options.seed,
+                              i);
+                ck_assert_msg(first_nodes == second_nodes, "Seed %#lx visited %lu and then %lu "
+                              "nodes on board %d", (unsigned long)options.seed,
+                              (unsigned long)first_nodes, (unsigned long)second_nodes, i);
+                max_nodes = (first_nodes > max_nodes) ? first_nodes : max_nodes;
+                // The counter is added to, not overwritten
+                total_nodes = 0;
+                options.search_nodes = &total_nodes;
+                run_test_case(test_input, &options, first_ret);
+                run_test_case(test_input, &options, first_ret);
+                options.search_nodes = NULL;
+                ck_assert_int_eq(2 * first_nodes, total_nodes);
+            }
+        }
+    }
+    ck_assert_msg(max_nodes > 1, "The boards never made the search branch");
+}
+END_TEST
+
+
+// The first template solve populates the shared template table while the others wait for it
+START_TEST(test_s09_template_threads)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_TEMPLATE;
+    run_thread_case(&options);
+}
+END_TEST
+
+
+// Each thread links up its own node arena, so the solves never share nodes
+START_TEST(test_s10_dlx_threads)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_DLX;
+    run_thread_case(&options);
+}
+END_TEST
+
+
+// Each thread encodes its own solver, so the solves never share clauses or assignments
+START_TEST(test_s11_sat_threads)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    options.engine = SUDO_ENGINE_SAT;
+    run_thread_case(&options);
+}
+END_TEST
+
+
+// The singles stall on these boards but the template eliminations carry them through
+START_TEST(test_s12_template_eliminations)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+    // The sudoku puzzles for this test case
+    const char *test_inputs[] = {
+        "3  1    7   6   5 9      4  5 82   9    647    4 9         76  4 72  1  68    5  ",
+        "     56  7      5     4  93  5   3  93 4     4    7  1   69   4  8        63  5  ",
+    };
+
+    // RUN TEST
+    search_only(&options);
+    options.search = false;
+    for (int i = 0; i < sizeof(test_inputs) / sizeof(test_inputs[0]); i++)
+    {
+        options.engine = SUDO_ENGINE_LOGIC;
+        run_test_case(test_inputs[i], &options, ENODATA);
+        options.engine = SUDO_ENGINE_TEMPLATE;
+        run_test_case(test_inputs[i], &options, ENOERR);
+    }
+}
+END_TEST
+
+
+// The 1 in row 5 breaks the board: the singles need the search to refute it, but no template
+// for some digit survives, so the template engine never searches
+START_TEST(test_s13_template_unsolvable)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+    uint64_t num_nodes = 0;  // Search nodes visited
+    char board[81] = { 0 };  // Unsolved board
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "     56  "
+                            "7      5 "
+                            "    4  93"
+                            "  5   3  "
+                            "93 41    "
+                            "4    7  1"
+                            "   69   4"
+                            "  8      "
+                            "  63  5  " };
+
+    // RUN TEST
+    search_only(&options);
+    ck_assert_int_eq(ENODATA, solve_counting_nodes(test_input, &options, board, &num_nodes));
+    ck_assert_msg(num_nodes > 0, "The singles refuted the board without searching");
+    options.engine = SUDO_ENGINE_TEMPLATE;
+    ck_assert_int_eq(ENODATA, solve_counting_nodes(test_input, &options, board, &num_nodes));
+    ck_assert_int_eq(0, num_nodes);
+    // The search still has to refute these
+    for (int i = 0; i < sizeof(test_unsat_boards) / sizeof(test_unsat_boards[0]); i++)
+    {
+        run_test_case(test_unsat_boards[i], &options, ENODATA);
+    }
+}
+END_TEST
+
+
+// Each board needs one kind of uniqueness elimination once the subsets stall
+START_TEST(test_s14_uniqueness_types)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+    // The sudoku puzzles for this test case
+    const char *test_inputs[] = {
+        // Unique Rectangle type 1
+        " 4 5    3 58 42    6   8   6  8          37 6   2  95           1    325    9 81 ",
+        // Unique Rectangle type 2
+        "   5     1  6   8  5   946      5  7 834         8        4 2 1 18  7  3      94 ",
+        // Unique Rectangle type 3
+        " 6       8  534      8  2  5 14   7       3  7       594 1 6 83 5      9  89  54 ",
+        // Unique Rectangle type 4
+        "           3   75    9368      1 5  8    4 6  64  3 7  47    8 5  2  93         2",
+        // BUG+1
+        "   1    2 7     6  3    1    53 9 4  235 86      6       4  271    73    9 6   5 ",
+    };
+
+    // RUN TEST
+    subsets_then(&options, SUDO_STRATEGY_UNIQUENESS);
+    for (int i = 0; i < sizeof(test_inputs) / sizeof(test_inputs[0]); i++)
+    {
+        options.assume_unique = false;
+        run_test_case(test_inputs[i], &options, ENODATA);
+        options.assume_unique = true;
+        run_test_case(test_inputs[i], &options, ENOERR);
+    }
+}
+END_TEST
+
+
+// This board has two solutions and a Unique Rectangle type 4 that would rule out one of them, so
+// the uniqueness strategies must leave it alone unless the caller asserts it is unique
+START_TEST(test_s15_uniqueness_multiple_solutions)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;               // Options for this test case
+    sudo_profile_t profile;               // Per-strategy statistics
+    sudo_strategy_stats_t *stats = NULL;  // The uniqueness strategies' entry in profile
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 5   32  "
+                            " 71      "
+                            "4  79 5  "
+                            "2  8   7 "
+                            "8     1  "
+                            "    4  6 "
+                            "  7 3    "
+                            "  6 2  45"
+                            "  2   6 1" };
+
+    // RUN TEST
+    subsets_then(&options, SUDO_STRATEGY_UNIQUENESS);
+    stats = profile.stats + SUDO_STRATEGY_UNIQUENESS;
+    options.profile = &profile;
+    options.search = true;
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    run_test_case(test_input, &options, ENOERR);
+    ck_assert_msg(stats->calls > 0, "The pipeline never reached the uniqueness strategies");
+    ck_assert_int_eq(0, stats->hits);
+    // Asserting uniqueness lets the rectangle fire
+    options.assume_unique = true;
+    options.search = false;
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    run_test_case(test_input, &options, ENODATA);
+    ck_assert_msg(stats->hits > 0, "The Unique Rectangle never fired");
+}
+END_TEST
+
+
+// Each board solves once fish_size reaches the size of the fish it needs, and not one size below
+START_TEST(test_s16_fish_sizes)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;  // Options for this test case
+    int size = 0;            // Size of the fish a board needs
+
+    // RUN TEST
+    subsets_then(&options, SUDO_STRATEGY_FISH);
+    for (int i = 0; i < sizeof(test_fish_boards) / sizeof(test_fish_boards[0]); i++)
+    {
+        size = i + 2;
+        options.fish_size = size - 1;
+        if (options.fish_size < 2)
+        {
+            options.fish_size = 0;  // Smaller than an X-Wing, so disabled
+        }
+        run_test_case(test_fish_boards[i], &options, ENODATA);
+        options.fish_size = size;
+        run_test_case(test_fish_boards[i], &options, ENOERR);
+        options.fish_size = 4;
+        run_test_case(test_fish_boards[i], &options, ENOERR);
+    }
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Logic-Solve_Board_Opts");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                   // Normal test cases
+    TCase *tc_error = tcase_create("Error");                     // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");               // Error test cases
+    TCase *tc_special = tcase_create("Special");                 // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_default_options);
+    tcase_add_test(tc_normal, test_n02_sat_engine);
+    tcase_add_test(tc_normal, test_n03_restart_schedules);
+    tcase_add_test(tc_error, test_e01_bad_pointer);
+    tcase_add_test(tc_error, test_e02_bad_options);
+    tcase_add_test(tc_error, test_e03_ttable_without_slots);
+    tcase_add_test(tc_error, test_e04_sat_invalid_board);
+    tcase_add_test(tc_error, test_e05_sat_negative_budget);
+    tcase_add_test(tc_boundary, test_b01_chain_counters_unused);
+    tcase_add_test(tc_boundary, test_b02_sat_solved);
+    tcase_add_test(tc_boundary, test_b03_search_nodes_unused);
+    tcase_add_test(tc_boundary, test_b04_restart_base_one);
+    tcase_add_test(tc_boundary, test_b05_template_solved);
+    tcase_add_test(tc_boundary, test_b06_fish_disabled);
+    tcase_add_test(tc_special, test_s01_chain_counters_coloring);
+    tcase_add_test(tc_special, test_s02_chain_counters_xchain);
+    tcase_add_test(tc_special, test_s03_chain_counters_accumulate);
+    tcase_add_test(tc_special, test_s04_shared_ttable);
+    tcase_add_test(tc_special, test_s05_shared_ttable_threads);
+    tcase_add_test(tc_special, test_s06_sat_unsatisfiable);
+    tcase_add_test(tc_special, test_s07_sat_clause_arena_full);
+    tcase_add_test(tc_special, test_s08_seed_reproducible);
+    tcase_add_test(tc_special, test_s09_template_threads);
+    tcase_add_test(tc_special, test_s10_dlx_threads);
+    tcase_add_test(tc_special, test_s11_sat_threads);
+    tcase_add_test(tc_special, test_s12_template_eliminations);
+    tcase_add_test(tc_special, test_s13_template_unsolvable);
+    tcase_add_test(tc_special, test_s14_uniqueness_types);
+    tcase_add_test(tc_special, test_s15_uniqueness_multiple_solutions);
+    tcase_add_test(tc_special, test_s16_fish_sizes);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void run_test_case(const char test_input[81], const sudo_options_t *options, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    char board[81] = { 0 };       // Copy of test_input to solve
+    char *board_ptr = NULL;       // board, or NULL if test_input is
+
+    // RUN IT
+    if (NULL != test_input)
+    {
+        memcpy(board, test_input, SUDO_BOARD_LEN);
+        board_ptr = board;
+    }
+    // Call the function
+    actual_ret = solve_board_opts(board_ptr, options);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "solve_board_opts() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Validate the solution
+    if (ENOERR == exp_return && NULL != test_input)
+    {
+        ck_assert_msg(ENOERR == is_game_over(board), "The board was not solved");
+        for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+        {
+            ck_assert_msg(SUDO_EMPTY_GRID == test_input[cell] || test_input[cell] == board[cell],
+                          "The solution changed the given at index %d", cell);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+void search_only(sudo_options_t *options)
+{
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_options(options));
+    options->order[0] = SUDO_STRATEGY_NAKED_SINGLE;
+    options->order[1] = SUDO_STRATEGY_HIDDEN_SINGLE;
+    options->num_strategies = 2;
+    options->restart = SUDO_RESTART_LUBY;
+    options->seed = 0x5EED;
+
+    // DONE
+    return;
+}
+
+
+void subsets_then(sudo_options_t *options, sudo_strategy_id_t strategy)
+{
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_options(options));
+    options->order[0] = SUDO_STRATEGY_NAKED_SINGLE;
+    options->order[1] = SUDO_STRATEGY_HIDDEN_SINGLE;
+    options->order[2] = SUDO_STRATEGY_LOCKED;
+    options->order[3] = SUDO_STRATEGY_SUBSETS;
+    options->order[4] = strategy;
+    options->num_strategies = 5;
+    options->search = false;
+
+    // DONE
+    return;
+}
+
+
+void *solve_search_boards(void *options)
+{
+    // SOLVE THEM
+    for (int i = 0; i < sizeof(test_search_boards) / sizeof(test_search_boards[0]); i++)
+    {
+        run_test_case(test_search_boards[i], options, ENOERR);
+    }
+
+    // DONE
+    return NULL;
+}
+
+
+void run_thread_case(const sudo_options_t *options)
+{
+    // LOCAL VARIABLES
+    pthread_t threads[TEST_NUM_THREADS] = { 0 };  // The solving threads
+
+    // RUN IT
+    for (int i = 0; i < TEST_NUM_THREADS; i++)
+    {
+        ck_assert_int_eq(0, pthread_create(threads + i, NULL, solve_search_boards,
+                                           (void *)options));
+    }
+    for (int i = 0; i < TEST_NUM_THREADS; i++)
+    {
+        ck_assert_int_eq(0, pthread_join(threads[i], NULL));
+    }
+
+    // DONE
+    return;
+}
+
+
+int solve_counting_nodes(const char test_input[81], const sudo_options_t *options,
+                         char board[81], uint64_t *num_nodes)
+{
+    // LOCAL VARIABLES
+    sudo_options_t counting = *options;  // options, counting into num_nodes
+
+    // SOLVE IT
+    *num_nodes = 0;
+    counting.search_nodes = num_nodes;
+    memcpy(board, test_input, SUDO_BOARD_LEN);
+
+    // DONE
+    return solve_board_opts(board, &counting);
+}
+
+
+void run_restart_case(int restart_base)
+{
+    // LOCAL VARIABLES
+    sudo_options_t options;         // Options for the randomized solves
+    sudo_options_t deterministic;   // Options for the reference solve
+    int exp_return = CANARY_INT;    // Return value of the reference solve
+    int actual_ret = CANARY_INT;    // Return value of a randomized solve
+    char exp_board[81] = { 0 };     // Board from the reference solve
+    char board[81] = { 0 };         // Board from a randomized solve
+    uint64_t num_nodes = 0;         // Search nodes visited
+    const char *test_input = NULL;  // Board to solve
+    // Every board to solve
+    const char *test_boards[sizeof(test_search_boards) / sizeof(test_search_boards[0])
+                            + sizeof(test_unsat_boards) / sizeof(test_unsat_boards[0])];
+    int num_boards = 0;             // Number of entries in test_boards
+
+    // SETUP
+    for (int i = 0; i < sizeof(test_search_boards) / sizeof(test_search_boards[0]); i++)
+    {
+        test_boards[num_boards++] = test_search_boards[i];
+    }
+    for (int i = 0; i < sizeof(test_unsat_boards) / sizeof(test_unsat_boards[0]); i++)
+    {
+        test_boards[num_boards++] = test_unsat_boards[i];
+    }
+    search_only(&options);
+    options.restart_base = restart_base;
+    deterministic = options;
+    deterministic.restart = SUDO_RESTART_NONE;
+
+    // RUN IT
+    for (int i = 0; i < num_boards; i++)
+    {
+        test_input = test_boards[i];
+        exp_return = solve_counting_nodes(test_input, &deterministic, exp_board, &num_nodes);
+        ck_assert_msg(ENOERR == exp_return || ENODATA == exp_return, "The deterministic search "
+                      "returned [%d] '%s' on board %d", exp_return, strerror(exp_return), i);
+        for (int r = 0; r < sizeof(test_restarts) / sizeof(test_restarts[0]); r++)
+        {
+            options.restart = test_restarts[r];
+            for (int s = 0; s < sizeof(test_seeds) / sizeof(test_seeds[0]); s++)
+            {
+                options.seed = test_seeds[s];
+                actual_ret = solve_counting_nodes(test_input, &options, board, &num_nodes);
+                ck_assert_msg(exp_return == actual_ret, "Schedule %d with seed %#lx returned "
+                              "[%d] '%s' instead of [%d] '%s' on board %d", options.restart,
+                              (unsigned long)options.seed, actual_ret, strerror(actual_ret),
+                              exp_return, strerror(exp_return), i);
+                ck_assert_msg(0 == memcmp(exp_board, board, SUDO_BOARD_LEN), "Schedule %d "
+                              "with seed %#lx disagreed with the deterministic search on "
+                              "board %d", options.restart, (unsigned long)options.seed, i);
+            }
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_logic_solve_board_opts.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,539 @@
+/*
+ *  Check unit test suit for sudo_profile.h's adapt_sudo_options() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_profile_adapt_sudo_options.bin && \
+code/dist/check_sudo_profile_adapt_sudo_options.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_profile_adapt_sudo_options.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_profile_adapt_sudo_options.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_profile_adapt_sudo_options.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_profile_adapt_sudo_options.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_profile_adapt_sudo_options.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL
+#include <stdint.h>                     // uint64_t
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+#include <string.h>                     // memcmp()
+// Local includes
+#include "sudo_logic.h"                 // init_sudo_options(), sudo_options_t
+#include "sudo_macros.h"                // ENOERR
+#include "sudo_profile.h"               // adapt_sudo_options(), SUDO_PROFILE_MIN_CALLS
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+// Shorter names for the strategies
+#define NAKED SUDO_STRATEGY_NAKED_SINGLE
+#define HIDDEN SUDO_STRATEGY_HIDDEN_SINGLE
+#define LOCKED SUDO_STRATEGY_LOCKED
+#define SUBSETS SUDO_STRATEGY_SUBSETS
+#define FISH SUDO_STRATEGY_FISH
+#define WINGS SUDO_STRATEGY_WINGS
+#define CHAINS SUDO_STRATEGY_CHAINS
+#define UNIQUENESS SUDO_STRATEGY_UNIQUENESS
+#define FORCING SUDO_STRATEGY_FORCING
+#define TEMPLATE SUDO_STRATEGY_TEMPLATE
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Set one strategy's statistics.
+ */
+void set_test_stats(sudo_profile_t *profile, sudo_strategy_id_t id, uint64_t calls,
+                    uint64_t hits, uint64_t progress, uint64_t ns);
+
+/*
+ *  Call adapt_sudo_options() on options whose pipeline is the first num_test entries of
+ *  test_order (at most SUDO_NUM_STRATEGIES are copied) and check the expected return value.  On
+ *  success, check the pipeline against exp_order.  On failure, check it was left alone.
+ */
+void run_test_case(const sudo_profile_t *profile, const sudo_strategy_id_t test_order[],
+                   int num_test, const sudo_strategy_id_t exp_order[], int num_exp,
+                   int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Ranked by progress per nanosecond, best first
+START_TEST(test_n01_ranked)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS, FISH };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, NAKED, FISH, LOCKED, SUBSETS };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 1000, 900, 5000, 2000);    // 2.5 per ns
+    set_test_stats(&profile, HIDDEN, 1000, 800, 9000, 3000);   // 3 per ns
+    set_test_stats(&profile, LOCKED, 500, 100, 400, 4000);     // 0.1 per ns
+    set_test_stats(&profile, SUBSETS, 500, 50, 100, 5000);     // 0.02 per ns
+    set_test_stats(&profile, FISH, 100, 10, 500, 1000);        // 0.5 per ns
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 5, exp_order, 5, ENOERR);
+}
+END_TEST
+
+
+// A fresh profile hasn't seen enough calls to trust, so the default pipeline is kept
+START_TEST(test_n02_fresh_profile)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;   // Statistics to rank by
+    sudo_options_t defaults;  // Default options
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    ck_assert_int_eq(ENOERR, init_sudo_options(&defaults));
+
+    // RUN TEST
+    run_test_case(&profile, defaults.order, defaults.num_strategies, defaults.order,
+                  defaults.num_strategies, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_profile)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_options_t options;       // Options to adapt
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    actual_ret = adapt_sudo_options(NULL, &options);
+    ck_assert_msg(exp_return == actual_ret, "adapt_sudo_options() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e02_null_options)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t profile;       // Statistics to rank by
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    actual_ret = adapt_sudo_options(&profile, NULL);
+    ck_assert_msg(exp_return == actual_ret, "adapt_sudo_options() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e03_negative_num_strategies)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+
+    // RUN TEST
+    run_test_case(&profile, test_order, -1, NULL, 0, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e04_too_many_strategies)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS, FISH, WINGS, CHAINS,
+                                        UNIQUENESS, FORCING, TEMPLATE };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+
+    // RUN TEST
+    run_test_case(&profile, test_order, SUDO_NUM_STRATEGIES + 1, NULL, 0, EINVAL);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_empty_pipeline)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 1000, 900, 5000, 2000);
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 0, NULL, 0, ENOERR);
+}
+END_TEST
+
+
+// Every strategy, ranked best first
+START_TEST(test_b02_full_pipeline)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS, FISH, WINGS, CHAINS,
+                                        UNIQUENESS, FORCING, TEMPLATE };
+    sudo_strategy_id_t exp_order[] = { TEMPLATE, FORCING, UNIQUENESS, CHAINS, WINGS, FISH,
+                                       SUBSETS, LOCKED, HIDDEN, NAKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+    {
+        set_test_stats(&profile, id, SUDO_PROFILE_MIN_CALLS, 1, id + 1, 1000);  // Later is better
+    }
+
+    // RUN TEST
+    run_test_case(&profile, test_order, SUDO_NUM_STRATEGIES, exp_order, SUDO_NUM_STRATEGIES,
+                  ENOERR);
+}
+END_TEST
+
+
+// SUDO_PROFILE_MIN_CALLS calls are enough to rank (or drop) a strategy, one fewer is not
+START_TEST(test_b03_min_calls)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, NAKED, SUBSETS };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, SUDO_PROFILE_MIN_CALLS - 1, 10, 9000, 1);   // Untried
+    set_test_stats(&profile, HIDDEN, SUDO_PROFILE_MIN_CALLS, 1, 1, 1000);       // Ranked
+    set_test_stats(&profile, LOCKED, SUDO_PROFILE_MIN_CALLS, 0, 0, 1000);       // Dropped
+    set_test_stats(&profile, SUBSETS, SUDO_PROFILE_MIN_CALLS - 1, 0, 0, 1000);  // Untried
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 4, exp_order, 3, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Strategies that never made progress are dropped, wherever they were in the pipeline
+START_TEST(test_s01_zero_hits_dropped)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS, FISH, WINGS };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, SUBSETS };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 1000, 0, 0, 2000);
+    set_test_stats(&profile, HIDDEN, 1000, 800, 9000, 3000);
+    set_test_stats(&profile, LOCKED, 500, 0, 0, 4000);
+    set_test_stats(&profile, SUBSETS, 500, 50, 100, 5000);
+    set_test_stats(&profile, FISH, 100, 0, 0, 1000);
+    set_test_stats(&profile, WINGS, 100, 0, 0, 0);  // Too fast to time and still useless
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 6, exp_order, 2, ENOERR);
+}
+END_TEST
+
+
+// Every strategy is useless: the search fallback is left to do all the work
+START_TEST(test_s02_all_dropped)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 1000, 0, 0, 2000);
+    set_test_stats(&profile, HIDDEN, 1000, 0, 0, 3000);
+    set_test_stats(&profile, LOCKED, 500, 0, 0, 4000);
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 3, NULL, 0, ENOERR);
+}
+END_TEST
+
+
+// Untried strategies go after the ranked ones, in the order they were in
+START_TEST(test_s03_untried_keep_order)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { CHAINS, NAKED, FORCING, HIDDEN, LOCKED, FISH };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, NAKED, CHAINS, FORCING, LOCKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, CHAINS, 3, 3, 500, 10);  // Great rate but too few calls
+    set_test_stats(&profile, NAKED, 1000, 900, 5000, 2000);
+    set_test_stats(&profile, FORCING, 0, 0, 0, 0);
+    set_test_stats(&profile, HIDDEN, 1000, 800, 9000, 3000);
+    set_test_stats(&profile, LOCKED, 1, 0, 0, 500);
+    set_test_stats(&profile, FISH, 400, 0, 0, 10000);
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 6, exp_order, 5, ENOERR);
+}
+END_TEST
+
+
+// Strategies with the same rate keep the order they were in
+START_TEST(test_s04_ties_keep_order)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { WINGS, NAKED, FISH, HIDDEN };
+    sudo_strategy_id_t exp_order[] = { FISH, WINGS, NAKED, HIDDEN };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, WINGS, 100, 10, 100, 1000);   // 0.1 per ns
+    set_test_stats(&profile, NAKED, 1000, 900, 300, 3000);  // 0.1 per ns
+    set_test_stats(&profile, FISH, 100, 10, 50, 100);      // 0.5 per ns
+    set_test_stats(&profile, HIDDEN, 1000, 800, 10, 100);  // 0.1 per ns
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 4, exp_order, 4, ENOERR);
+}
+END_TEST
+
+
+// A strategy too fast to time counts as taking 1 ns
+START_TEST(test_s05_zero_ns)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN, LOCKED, SUBSETS };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, NAKED, SUBSETS, LOCKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 100, 10, 4, 1);     // 4 per ns
+    set_test_stats(&profile, HIDDEN, 100, 10, 5, 0);    // 5 per ns
+    set_test_stats(&profile, LOCKED, 100, 10, 1, 0);    // 1 per ns
+    set_test_stats(&profile, SUBSETS, 100, 10, 2, 1);   // 2 per ns
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 4, exp_order, 4, ENOERR);
+}
+END_TEST
+
+
+// Only the strategies in the pipeline are ranked, however good the others look
+START_TEST(test_s06_partial_pipeline)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { SUBSETS, LOCKED };
+    sudo_strategy_id_t exp_order[] = { LOCKED, SUBSETS };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, 1000, 900, 5000, 2000);
+    set_test_stats(&profile, HIDDEN, 1000, 800, 9000, 3000);
+    set_test_stats(&profile, LOCKED, 500, 100, 400, 4000);
+    set_test_stats(&profile, SUBSETS, 500, 50, 100, 5000);
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 2, exp_order, 2, ENOERR);
+}
+END_TEST
+
+
+// Huge statistics don't overflow the rate comparison
+START_TEST(test_s07_huge_stats)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t profile;  // Statistics to rank by
+    sudo_strategy_id_t test_order[] = { NAKED, HIDDEN };
+    sudo_strategy_id_t exp_order[] = { HIDDEN, NAKED };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&profile));
+    set_test_stats(&profile, NAKED, UINT64_MAX, UINT64_MAX, UINT64_MAX - 1, UINT64_MAX);
+    set_test_stats(&profile, HIDDEN, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX);
+
+    // RUN TEST
+    run_test_case(&profile, test_order, 2, exp_order, 2, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Profile-Adapt_SUDO_Options");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                       // Normal test cases
+    TCase *tc_error = tcase_create("Error");                         // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                   // Error test cases
+    TCase *tc_special = tcase_create("Special");                     // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_ranked);
+    tcase_add_test(tc_normal, test_n02_fresh_profile);
+    tcase_add_test(tc_error, test_e01_null_profile);
+    tcase_add_test(tc_error, test_e02_null_options);
+    tcase_add_test(tc_error, test_e03_negative_num_strategies);
+    tcase_add_test(tc_error, test_e04_too_many_strategies);
+    tcase_add_test(tc_boundary, test_b01_empty_pipeline);
+    tcase_add_test(tc_boundary, test_b02_full_pipeline);
+    tcase_add_test(tc_boundary, test_b03_min_calls);
+    tcase_add_test(tc_special, test_s01_zero_hits_dropped);
+    tcase_add_test(tc_special, test_s02_all_dropped);
+    tcase_add_test(tc_special, test_s03_untried_keep_order);
+    tcase_add_test(tc_special, test_s04_ties_keep_order);
+    tcase_add_test(tc_special, test_s05_zero_ns);
+    tcase_add_test(tc_special, test_s06_partial_pipeline);
+    tcase_add_test(tc_special, test_s07_huge_stats);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void set_test_stats(sudo_profile_t *profile, sudo_strategy_id_t id, uint64_t calls,
+                    uint64_t hits, uint64_t progress, uint64_t ns)
+{
+    // SET THEM
+    profile->stats[id].calls = calls;
+    profile->stats[id].hits = hits;
+    profile->stats[id].progress = progress;
+    profile->stats[id].ns = ns;
+
+    // DONE
+    return;
+}
+
+
+void run_test_case(const sudo_profile_t *profile, const sudo_strategy_id_t test_order[],
+                   int num_test, const sudo_strategy_id_t exp_order[], int num_exp,
+                   int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_options_t options;       // Options to adapt
+    sudo_options_t original;      // Options before they were adapted
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_options(&options));
+    for (int i = 0; i < num_test && i < SUDO_NUM_STRATEGIES; i++)
+    {
+        options.order[i] = test_order[i];
+    }
+    options.num_strategies = num_test;
+    original = options;
+
+    // RUN IT
+    // Call the function
+    actual_ret = adapt_sudo_options(profile, &options);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "adapt_sudo_options() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Check the pipeline
+    if (ENOERR == exp_return)
+    {
+        ck_assert_msg(num_exp == options.num_strategies, "The pipeline has %d strategies "
+                      "instead of %d", options.num_strategies, num_exp);
+        for (int i = 0; i < num_exp; i++)
+        {
+            ck_assert_msg(exp_order[i] == options.order[i], "Stage %d is the %s strategy "
+                          "instead of the %s strategy", i, sudo_strategies[options.order[i]].name,
+                          sudo_strategies[exp_order[i]].name);
+        }
+    }
+    else
+    {
+        ck_assert_msg(original.num_strategies == options.num_strategies
+                      && 0 == memcmp(original.order, options.order, sizeof(options.order)),
+                      "adapt_sudo_options() changed the pipeline on failure");
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_profile_adapt_sudo_options.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,494 @@
+/*
+ *  Check unit test suit for sudo_profile.h's load_sudo_profile() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_profile_load_sudo_profile.bin && \
+code/dist/check_sudo_profile_load_sudo_profile.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_profile_load_sudo_profile.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_profile_load_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_profile_load_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_profile_load_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_profile_load_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENOENT
+#include <stdint.h>                     // UINT64_MAX, uint64_t
+#include <stdio.h>                      // fopen(), fputs(), fclose(), remove()
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+#include <string.h>                     // memcmp(), memset()
+// Local includes
+#include "sudo_macros.h"                // ENOERR
+#include "sudo_profile.h"               // init_sudo_profile(), load_sudo_profile()
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem(), resolve_test_input()
+
+// Scratch file the test cases load from
+#define TEST_FILENAME "./code/test/test_output/check_sudo_profile_load_sudo_profile.prof"
+// First line of a profile file
+#define TEST_HEADER "sudo_profile 1\n"
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Set one strategy's statistics.
+ */
+void set_test_stats(sudo_profile_t *profile, sudo_strategy_id_t id, uint64_t calls,
+                    uint64_t hits, uint64_t progress, uint64_t ns);
+
+/*
+ *  Write test_input to TEST_FILENAME, load it into a dirty profile, and check the expected return
+ *  value.  On success, check the profile against exp_profile.  Removes the file.
+ */
+void run_test_case(const char *test_input, const sudo_profile_t *exp_profile, int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// As save_sudo_profile() writes it
+START_TEST(test_n01_saved_profile)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "0 1000 900 5000 20000 Naked Single\n"
+                                "1 800 700 4000 30000 Hidden Single\n"
+                                "2 600 300 900 60000 Locked Candidates\n"
+                                "3 500 100 200 90000 Subsets\n"
+                                "4 400 0 0 10000 Fish\n"
+                                "5 400 10 20 70000 Wings\n"
+                                "6 300 5 9 8000000000 Chains\n"
+                                "7 0 0 0 0 Uniqueness\n"
+                                "8 20 2 30 5000000 Forcing Chains\n"
+                                "9 0 0 0 0 Templates\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 0, 1000, 900, 5000, 20000);
+    set_test_stats(&exp_profile, 1, 800, 700, 4000, 30000);
+    set_test_stats(&exp_profile, 2, 600, 300, 900, 60000);
+    set_test_stats(&exp_profile, 3, 500, 100, 200, 90000);
+    set_test_stats(&exp_profile, 4, 400, 0, 0, 10000);
+    set_test_stats(&exp_profile, 5, 400, 10, 20, 70000);
+    set_test_stats(&exp_profile, 6, 300, 5, 9, 8000000000ULL);
+    set_test_stats(&exp_profile, 8, 20, 2, 30, 5000000);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+// The names are only there for people reading the file
+START_TEST(test_n02_no_names)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "0 1000 900 5000 20000\n"
+                                "1 800 700 4000 30000\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 0, 1000, 900, 5000, 20000);
+    set_test_stats(&exp_profile, 1, 800, 700, 4000, 30000);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_profile)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // RUN TEST
+    actual_ret = load_sudo_profile(NULL, filename);
+    ck_assert_msg(exp_return == actual_ret, "load_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+START_TEST(test_e02_null_filename)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t profile;       // Profile to load
+
+    // RUN TEST
+    actual_ret = load_sudo_profile(&profile, NULL);
+    ck_assert_msg(exp_return == actual_ret, "load_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e03_missing_file)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOENT;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t profile;       // Profile to load
+    // Absolute path of a file that doesn't exist
+    char *filename = resolve_test_input("./code/test/test_output/missing_file.prof");
+
+    // RUN TEST
+    actual_ret = load_sudo_profile(&profile, filename);
+    ck_assert_msg(exp_return == actual_ret, "load_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+// Some other file that happens to hold numbers
+START_TEST(test_e04_foreign_file)
+{
+    // LOCAL VARIABLES
+    // Profile file contents
+    const char test_input[] = { "0 1000 900 5000 20000 Naked Single\n"
+                                "1 800 700 4000 30000 Hidden Single\n" };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e05_foreign_version)
+{
+    // LOCAL VARIABLES
+    // Profile file contents
+    const char test_input[] = { "sudo_profile 2\n"
+                                "0 1000 900 5000 20000 Naked Single\n" };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e06_not_a_number)
+{
+    // LOCAL VARIABLES
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "0 1000 900 5000 20000 Naked Single\n"
+                                "1 800 lots 4000 30000 Hidden Single\n" };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e07_truncated_line)
+{
+    // LOCAL VARIABLES
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "0 1000 900 5000 20000 Naked Single\n"
+                                "1 800 700\n" };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_e08_blank_line)
+{
+    // LOCAL VARIABLES
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "\n"
+                                "0 1000 900 5000 20000 Naked Single\n" };
+
+    // RUN TEST
+    run_test_case(test_input, NULL, EINVAL);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_empty_file)
+{
+    // RUN TEST
+    run_test_case("", NULL, EINVAL);
+}
+END_TEST
+
+
+START_TEST(test_b02_header_only)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+
+    // RUN TEST
+    run_test_case(TEST_HEADER, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+START_TEST(test_b03_max_stats)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "9 18446744073709551615 18446744073709551615 "
+                                "18446744073709551615 18446744073709551615 Templates\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 9, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+// Lines for strategies this build doesn't know about are skipped
+START_TEST(test_b04_unknown_ids)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "-1 1 1 1 1 before the first\n"
+                                "0 1000 900 5000 20000 Naked Single\n"
+                                "10 2 2 2 2 after the last\n"
+                                "9 40 4 80 9000 Templates\n"
+                                "1000 3 3 3 3 far after the last\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 0, 1000, 900, 5000, 20000);
+    set_test_stats(&exp_profile, 9, 40, 4, 80, 9000);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Lines may come in any order and a repeated id keeps its last line
+START_TEST(test_s01_out_of_order)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { TEST_HEADER
+                                "6 300 5 9 8000 Chains\n"
+                                "2 600 300 900 60000 Locked Candidates\n"
+                                "6 301 6 10 8001 Chains\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 2, 600, 300, 900, 60000);
+    set_test_stats(&exp_profile, 6, 301, 6, 10, 8001);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+// A file with Windows line endings still loads
+START_TEST(test_s02_crlf)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t exp_profile;  // Expected profile
+    // Profile file contents
+    const char test_input[] = { "sudo_profile 1\r\n"
+                                "3 500 100 200 90000 Subsets\r\n" };
+
+    // SETUP
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&exp_profile));
+    set_test_stats(&exp_profile, 3, 500, 100, 200, 90000);
+
+    // RUN TEST
+    run_test_case(test_input, &exp_profile, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Profile-Load_SUDO_Profile");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                      // Normal test cases
+    TCase *tc_error = tcase_create("Error");                        // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                  // Error test cases
+    TCase *tc_special = tcase_create("Special");                    // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_saved_profile);
+    tcase_add_test(tc_normal, test_n02_no_names);
+    tcase_add_test(tc_error, test_e01_null_profile);
+    tcase_add_test(tc_error, test_e02_null_filename);
+    tcase_add_test(tc_error, test_e03_missing_file);
+    tcase_add_test(tc_error, test_e04_foreign_file);
+    tcase_add_test(tc_error, test_e05_foreign_version);
+    tcase_add_test(tc_error, test_e06_not_a_number);
+    tcase_add_test(tc_error, test_e07_truncated_line);
+    tcase_add_test(tc_error, test_e08_blank_line);
+    tcase_add_test(tc_boundary, test_b01_empty_file);
+    tcase_add_test(tc_boundary, test_b02_header_only);
+    tcase_add_test(tc_boundary, test_b03_max_stats);
+    tcase_add_test(tc_boundary, test_b04_unknown_ids);
+    tcase_add_test(tc_special, test_s01_out_of_order);
+    tcase_add_test(tc_special, test_s02_crlf);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void set_test_stats(sudo_profile_t *profile, sudo_strategy_id_t id, uint64_t calls,
+                    uint64_t hits, uint64_t progress, uint64_t ns)
+{
+    // SET THEM
+    profile->stats[id].calls = calls;
+    profile->stats[id].hits = hits;
+    profile->stats[id].progress = progress;
+    profile->stats[id].ns = ns;
+
+    // DONE
+    return;
+}
+
+
+void run_test_case(const char *test_input, const sudo_profile_t *exp_profile, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t profile;       // Profile to load
+    FILE *file = NULL;            // The profile file
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // SETUP
+    file = fopen(filename, "w");
+    ck_assert_msg(NULL != file, "Unable to create %s", filename);
+    ck_assert_msg(EOF != fputs(test_input, file) || '\0' == test_input[0],
+                  "Unable to write %s", filename);
+    ck_assert_msg(0 == fclose(file), "Unable to close %s", filename);
+    memset(&profile, 0xA5, sizeof(profile));  // Dirty it so stale statistics would show
+
+    // RUN IT
+    // Call the function
+    actual_ret = load_sudo_profile(&profile, filename);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "load_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Check the statistics
+    if (ENOERR == exp_return)
+    {
+        for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+        {
+            ck_assert_msg(0 == memcmp(exp_profile->stats + id, profile.stats + id,
+                                      sizeof(profile.stats[id])),
+                          "The %s strategy's statistics were not loaded as expected",
+                          sudo_strategies[id].name);
+        }
+    }
+
+    // CLEANUP
+    remove(filename);
+    free_devops_mem((void **)&filename);
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_profile_load_sudo_profile.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,360 @@
+/*
+ *  Check unit test suit for sudo_profile.h's save_sudo_profile() function.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_profile_save_sudo_profile.bin && \
+code/dist/check_sudo_profile_save_sudo_profile.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_profile_save_sudo_profile.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_profile_save_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_profile_save_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_profile_save_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_profile_save_sudo_profile.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL, ENOENT
+#include <inttypes.h>                   // PRIu64
+#include <stdint.h>                     // uint64_t
+#include <stdio.h>                      // fopen(), fgets(), fclose(), remove(), snprintf()
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+#include <string.h>                     // memcmp(), memset()
+// Local includes
+#include "sudo_macros.h"                // ENOERR
+#include "sudo_profile.h"               // load_sudo_profile(), save_sudo_profile()
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem(), resolve_test_input()
+
+// Scratch file the test cases save to
+#define TEST_FILENAME "./code/test/test_output/check_sudo_profile_save_sudo_profile.prof"
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Give every statistic in profile its own value, derived from base.
+ */
+void fill_test_profile(sudo_profile_t *profile, uint64_t base);
+
+/*
+ *  Save test_input to TEST_FILENAME and check the expected return value.  On success, load the
+ *  file back into a dirty profile and check that it matches test_input.  Removes the file.
+ */
+void run_test_case(const sudo_profile_t *test_input, int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_n01_populated)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t test_input;  // Profile to save
+
+    // RUN TEST
+    fill_test_profile(&test_input, 1);
+    run_test_case(&test_input, ENOERR);
+}
+END_TEST
+
+
+START_TEST(test_n02_zeroed)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t test_input;  // Profile to save
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&test_input));
+    run_test_case(&test_input, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_null_profile)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // RUN TEST
+    actual_ret = save_sudo_profile(NULL, filename);
+    ck_assert_msg(exp_return == actual_ret, "save_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+START_TEST(test_e02_null_filename)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t test_input;    // Profile to save
+
+    // RUN TEST
+    fill_test_profile(&test_input, 1);
+    actual_ret = save_sudo_profile(&test_input, NULL);
+    ck_assert_msg(exp_return == actual_ret, "save_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+}
+END_TEST
+
+
+START_TEST(test_e03_missing_directory)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOENT;      // Expected return value for this test case
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t test_input;    // Profile to save
+    // Absolute path of a file in a directory that doesn't exist
+    char *filename = resolve_test_input("./code/test/test_output/missing_dir/test.prof");
+
+    // RUN TEST
+    fill_test_profile(&test_input, 1);
+    actual_ret = save_sudo_profile(&test_input, filename);
+    ck_assert_msg(exp_return == actual_ret, "save_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_max_stats)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t test_input;  // Profile to save
+
+    // RUN TEST
+    memset(&test_input, 0xFF, sizeof(test_input));  // Every statistic is UINT64_MAX
+    run_test_case(&test_input, ENOERR);
+}
+END_TEST
+
+
+START_TEST(test_b02_one_strategy)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t test_input;  // Profile to save
+
+    // RUN TEST
+    ck_assert_int_eq(ENOERR, init_sudo_profile(&test_input));
+    test_input.stats[SUDO_NUM_STRATEGIES - 1].calls = 1;
+    test_input.stats[SUDO_NUM_STRATEGIES - 1].hits = 1;
+    test_input.stats[SUDO_NUM_STRATEGIES - 1].progress = 1;
+    test_input.stats[SUDO_NUM_STRATEGIES - 1].ns = 1;
+    run_test_case(&test_input, ENOERR);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Saving over an existing profile replaces it
+START_TEST(test_s01_overwrite)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t old_profile;  // Profile saved first
+    sudo_profile_t test_input;   // Profile saved over it
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // RUN TEST
+    fill_test_profile(&old_profile, 1000);
+    ck_assert_int_eq(ENOERR, save_sudo_profile(&old_profile, filename));
+    fill_test_profile(&test_input, 1);
+    run_test_case(&test_input, ENOERR);
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+// A header line, then one "id calls hits progress ns name" line per strategy
+START_TEST(test_s02_file_format)
+{
+    // LOCAL VARIABLES
+    sudo_profile_t test_input;                  // Profile to save
+    FILE *file = NULL;                          // The saved profile
+    char line[128] = { 0 };                     // One line of the file
+    char exp_line[128] = { 0 };                 // Expected line
+    const sudo_strategy_stats_t *stats = NULL;  // Statistics for one strategy
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // SETUP
+    fill_test_profile(&test_input, 1);
+    ck_assert_int_eq(ENOERR, save_sudo_profile(&test_input, filename));
+    file = fopen(filename, "r");
+    ck_assert_msg(NULL != file, "Unable to open %s", filename);
+
+    // RUN TEST
+    ck_assert_msg(NULL != fgets(line, sizeof(line), file), "%s is empty", filename);
+    ck_assert_str_eq("sudo_profile 1\n", line);
+    for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+    {
+        stats = test_input.stats + id;
+        snprintf(exp_line, sizeof(exp_line), "%d %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+                 " %s\n", id, stats->calls, stats->hits, stats->progress, stats->ns,
+                 sudo_strategies[id].name);
+        ck_assert_msg(NULL != fgets(line, sizeof(line), file), "Strategy %d has no line", id);
+        ck_assert_str_eq(exp_line, line);
+    }
+    ck_assert_msg(NULL == fgets(line, sizeof(line), file), "Unexpected trailing line: %s", line);
+
+    // CLEANUP
+    fclose(file);
+    remove(filename);
+    free_devops_mem((void **)&filename);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Profile-Save_SUDO_Profile");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                      // Normal test cases
+    TCase *tc_error = tcase_create("Error");                        // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                  // Error test cases
+    TCase *tc_special = tcase_create("Special");                    // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_populated);
+    tcase_add_test(tc_normal, test_n02_zeroed);
+    tcase_add_test(tc_error, test_e01_null_profile);
+    tcase_add_test(tc_error, test_e02_null_filename);
+    tcase_add_test(tc_error, test_e03_missing_directory);
+    tcase_add_test(tc_boundary, test_b01_max_stats);
+    tcase_add_test(tc_boundary, test_b02_one_strategy);
+    tcase_add_test(tc_special, test_s01_overwrite);
+    tcase_add_test(tc_special, test_s02_file_format);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void fill_test_profile(sudo_profile_t *profile, uint64_t base)
+{
+    // FILL IT
+    for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+    {
+        profile->stats[id].calls = base * 1000 + id;
+        profile->stats[id].hits = base * 100 + id;
+        profile->stats[id].progress = base * 10000 + id;
+        profile->stats[id].ns = base * 1000000000000ULL + id;  // Needs more than 32 bits
+    }
+
+    // DONE
+    return;
+}
+
+
+void run_test_case(const sudo_profile_t *test_input, int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    sudo_profile_t loaded;        // Profile read back from the file
+    char *filename = resolve_test_input(TEST_FILENAME);  // Absolute path of the scratch file
+
+    // RUN IT
+    // Call the function
+    actual_ret = save_sudo_profile(test_input, filename);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "save_sudo_profile() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Read it back
+    if (ENOERR == exp_return)
+    {
+        memset(&loaded, 0xA5, sizeof(loaded));  // Dirty it so every statistic has to be read
+        ck_assert_int_eq(ENOERR, load_sudo_profile(&loaded, filename));
+        for (int id = 0; id < SUDO_NUM_STRATEGIES; id++)
+        {
+            ck_assert_msg(0 == memcmp(test_input->stats + id, loaded.stats + id,
+                                      sizeof(loaded.stats[id])),
+                          "The %s strategy's statistics did not survive the round trip",
+                          sudo_strategies[id].name);
+        }
+    }
+
+    // CLEANUP
+    remove(filename);
+    free_devops_mem((void **)&filename);
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_profile_save_sudo_profile.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,508 @@
+/*
+ *  Check unit test suit for sudo_validation.h's validate_board() function.  The special test
+ *  cases also hold validate_board()'s private fast paths, count_invalid_entries() and
+ *  has_duplicate_entries(), to the answers of the diagnostic loops they stand in for.
+ *
+ *  Copy/paste the following from the repo's top-level directory...
+
+make -C code dist/check_sudo_validation_validate_board.bin && \
+code/dist/check_sudo_validation_validate_board.bin && CK_FORK=no valgrind --leak-check=full --show-leak-kinds=all code/dist/check_sudo_validation_validate_board.bin
+
+ *
+ *  The test cases have been split up by normal, error, boundary, and special (NEBS).
+ *  Execute this command to run just one NEBS category:
+ *
+
+export CK_RUN_CASE="Normal" && ./code/dist/check_sudo_validation_validate_board.bin; unset CK_RUN_CASE  # Just run the Normal test cases
+export CK_RUN_CASE="Error" && ./code/dist/check_sudo_validation_validate_board.bin; unset CK_RUN_CASE  # Just run the Error test cases
+export CK_RUN_CASE="Boundary" && ./code/dist/check_sudo_validation_validate_board.bin; unset CK_RUN_CASE  # Just run the Boundary test cases
+export CK_RUN_CASE="Special" && ./code/dist/check_sudo_validation_validate_board.bin; unset CK_RUN_CASE  # Just run the Special test cases
+
+ *
+ */
+
+#ifndef SUDO_DEBUG
+#define SUDO_DEBUG
+#endif  /* SUDO_DEBUG */
+
+#include <check.h>                      // START_TEST(), END_TEST, Suite
+#include <errno.h>                      // EINVAL
+#include <stdbool.h>                    // bool, false, true
+#include <stdlib.h>                     // EXIT_FAILURE, EXIT_SUCCESS
+// Local includes
+#include "sudo_macros.h"                // ENOERR, SUDO_BOARD_LEN, SUDO_EMPTY_GRID
+#include "sudo_validation.h"            // validate_board()
+#include "unit_test_code.h"             // CANARY_INT, free_devops_mem()
+
+/*
+ *  Private to sudo_validation.c.  The fast paths...
+ */
+int count_invalid_entries(const char board[81]);
+bool has_duplicate_entries(const char board[81]);
+/*
+ *  ...and the diagnostic loops that find the first violation to report.
+ */
+int validate_board_entry(char board_entry);
+int validate_board_rows(const char board[81]);
+int validate_board_cols(const char board[81]);
+int validate_board_grids(const char board[81]);
+
+
+/**************************************************************************************************/
+/************************************ HELPER CODE DECLARATION *************************************/
+/**************************************************************************************************/
+
+/*
+ *  Create the Check test suite.
+ */
+Suite *create_test_suite(void);
+
+/*
+ *  Hold the fast paths to the diagnostic loops for one board: count_invalid_entries() must
+ *  count exactly the entries validate_board_entry() rejects and, for a board of valid entries,
+ *  has_duplicate_entries() must agree with the row, col, and grid loops.  Also verify
+ *  validate_board() rejects the board if either one found a violation.
+ */
+void check_fast_paths(const char board[81]);
+
+/*
+ *  Make the function call, check the expected return value, and verify test_input was not
+ *  modified.
+ */
+void run_test_case(char test_input[81], int exp_return);
+
+
+/**************************************************************************************************/
+/*************************************** NORMAL TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+// Take from: https://sudoku.com/easy/
+START_TEST(test_n01_easy_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+// Take from: https://sudoku.com/extreme/
+START_TEST(test_n02_extreme_sudoku)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "       79"
+                            "  4      "
+                            "   67 5  "
+                            "9   81   "
+                            "    397 6"
+                            " 7       "
+                            "3 2   6  "
+                            "56      3"
+                            "   8    4" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/**************************************** ERROR TEST CASES ****************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_e01_invalid_char_zero)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 10" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e02_invalid_char_nul)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { " 683 9 7 "
+                            " 42     1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7    158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1 " };
+
+    // RUN TEST
+    test_input[40] = '\0';
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e03_bad_pointer)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char *test_input = NULL;
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e04_invalid_board_row_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "1       1"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e05_invalid_board_col_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "        9"
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "         "
+                            "        9" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_e06_invalid_board_grid_dupe)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "         "
+                            "         "
+                            "         "
+                            "         "
+                            "   5     "
+                            "     5   "
+                            "         "
+                            "         "
+                            "         " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************** BOUNDARY TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+START_TEST(test_b01_solved)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "435269781"
+                            "682571493"
+                            "197834562"
+                            "826195347"
+                            "374682915"
+                            "951743628"
+                            "519326874"
+                            "248957136"
+                            "763418259" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+START_TEST(test_b02_empty)
+{
+    // LOCAL VARIABLES
+    int exp_return = ENOERR;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "                                                                                 " };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+// Every entry is invalid
+START_TEST(test_b03_all_invalid)
+{
+    // LOCAL VARIABLES
+    int exp_return = EINVAL;  // Expected return value for this test case
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "000000000000000000000000000000000000000000000000000000000000000000000000000000000" };
+
+    // RUN TEST
+    run_test_case(test_input, exp_return);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/*************************************** SPECIAL TEST CASES ***************************************/
+/**************************************************************************************************/
+
+
+// Overwrite each cell of a solved board, in turn, with every interesting character
+START_TEST(test_s01_fast_paths_one_change)
+{
+    // LOCAL VARIABLES
+    // Valid entries, neighbors of the valid ranges, and characters with the high bit set
+    char entries[] = { '0', '1', '5', '9', ':', '/', SUDO_EMPTY_GRID, '\0', '\t', '\n', 'a',
+                       (char)0x80, (char)0xB1, (char)0xFF };
+    char test_input[81] = { 0 };  // The board under test
+    // The board to change
+    char solved[81] = { "435269781682571493197834562826195347374682915951743628519326874248957136763418259" };
+
+    // RUN TEST
+    for (int cell = 0; cell < SUDO_BOARD_LEN; cell++)
+    {
+        for (int i = 0; i < sizeof(entries) / sizeof(entries[0]); i++)
+        {
+            memcpy(test_input, solved, SUDO_BOARD_LEN);
+            test_input[cell] = entries[i];
+            check_fast_paths(test_input);
+        }
+    }
+}
+END_TEST
+
+
+// Place the same digit in every pair of cells of an empty board
+START_TEST(test_s02_fast_paths_every_pair)
+{
+    // LOCAL VARIABLES
+    char test_input[81] = { 0 };  // The board under test
+
+    // RUN TEST
+    for (int first = 0; first < SUDO_BOARD_LEN; first++)
+    {
+        for (int second = first + 1; second < SUDO_BOARD_LEN; second++)
+        {
+            memset(test_input, SUDO_EMPTY_GRID, SUDO_BOARD_LEN);
+            test_input[first] = '7';
+            test_input[second] = '7';
+            check_fast_paths(test_input);
+        }
+    }
+}
+END_TEST
+
+
+// Several invalid characters: the fast path must count every one of them
+START_TEST(test_s03_fast_paths_many_invalid)
+{
+    // LOCAL VARIABLES
+    // The sudoku puzzle for this test case
+    char test_input[81] = { "0 683 9 7"
+                            " 42 x   1"
+                            "1 7 5 6  "
+                            "  5 7 12 "
+                            "7  . 158 "
+                            "    3 74 "
+                            "   19 2 5"
+                            "8 162 39 "
+                            "9  543 1A" };
+
+    // RUN TEST
+    ck_assert_int_eq(4, count_invalid_entries(test_input));
+    check_fast_paths(test_input);
+    run_test_case(test_input, EINVAL);
+}
+END_TEST
+
+
+/**************************************************************************************************/
+/************************************* HELPER CODE DEFINITION *************************************/
+/**************************************************************************************************/
+
+
+Suite *create_test_suite(void)
+{
+    // LOCAL VARIABLES
+    Suite *suite = suite_create("SUDO_Validation-Validate_Board");  // Test suite
+    TCase *tc_normal = tcase_create("Normal");                      // Normal test cases
+    TCase *tc_error = tcase_create("Error");                        // Error test cases
+    TCase *tc_boundary = tcase_create("Boundary");                  // Error test cases
+    TCase *tc_special = tcase_create("Special");                    // Special test cases
+
+    // SETUP TEST CASES
+    tcase_add_test(tc_normal, test_n01_easy_sudoku);
+    tcase_add_test(tc_normal, test_n02_extreme_sudoku);
+    tcase_add_test(tc_error, test_e01_invalid_char_zero);
+    tcase_add_test(tc_error, test_e02_invalid_char_nul);
+    tcase_add_test(tc_error, test_e03_bad_pointer);
+    tcase_add_test(tc_error, test_e04_invalid_board_row_dupe);
+    tcase_add_test(tc_error, test_e05_invalid_board_col_dupe);
+    tcase_add_test(tc_error, test_e06_invalid_board_grid_dupe);
+    tcase_add_test(tc_boundary, test_b01_solved);
+    tcase_add_test(tc_boundary, test_b02_empty);
+    tcase_add_test(tc_boundary, test_b03_all_invalid);
+    tcase_add_test(tc_special, test_s01_fast_paths_one_change);
+    tcase_add_test(tc_special, test_s02_fast_paths_every_pair);
+    tcase_add_test(tc_special, test_s03_fast_paths_many_invalid);
+    suite_add_tcase(suite, tc_normal);
+    suite_add_tcase(suite, tc_error);
+    suite_add_tcase(suite, tc_boundary);
+    suite_add_tcase(suite, tc_special);
+
+    // DONE
+    return suite;
+}
+
+
+void check_fast_paths(const char board[81])
+{
+    // LOCAL VARIABLES
+    int num_invalid = 0;     // Number of entries the diagnostic loop rejects
+    bool has_dupe = false;   // Did the diagnostic loops find a duplicate?
+    bool fast_dupe = false;  // Did the fast path find a duplicate?
+
+    // CHECK IT
+    // Entries
+    for (int i = 0; i < SUDO_BOARD_LEN; i++)
+    {
+        if (ENOERR != validate_board_entry(board[i]))
+        {
+            num_invalid++;
+        }
+    }
+    ck_assert_msg(num_invalid == count_invalid_entries(board), "count_invalid_entries() "
+                  "found %d invalid entries instead of %d\n", count_invalid_entries(board),
+                  num_invalid);
+    // Elements: the diagnostic loops only accept valid entries
+    if (0 == num_invalid)
+    {
+        has_dupe = ENOERR != validate_board_rows(board) || ENOERR != validate_board_cols(board)
+                   || ENOERR != validate_board_grids(board);
+        fast_dupe = has_duplicate_entries(board);
+        ck_assert_msg(has_dupe == fast_dupe, "has_duplicate_entries() returned %s instead of "
+                      "%s\n", BOOL_STR_LIT(fast_dupe), BOOL_STR_LIT(has_dupe));
+    }
+    // Both feed validate_board()
+    ck_assert_int_eq((0 == num_invalid && false == has_dupe) ? ENOERR : EINVAL,
+                     validate_board(board));
+
+    // DONE
+    return;
+}
+
+
+void run_test_case(char test_input[81], int exp_return)
+{
+    // LOCAL VARIABLES
+    int actual_ret = CANARY_INT;  // Return value of the tested function
+    char input_copy[81] = { 0 };  // Copy of test_input, to verify it was not modified
+
+    // RUN IT
+    if (NULL != test_input)
+    {
+        memcpy(input_copy, test_input, SUDO_BOARD_LEN);
+        check_fast_paths(test_input);
+    }
+    // Call the function
+    actual_ret = validate_board(test_input);
+    // Compare actual return value to expected return value
+    ck_assert_msg(exp_return == actual_ret, "validate_board() returned [%d] '%s' "
+                  "instead of [%d] '%s'\n", actual_ret, strerror(actual_ret),
+                  exp_return, strerror(exp_return));
+    // Verify the input was not modified
+    if (NULL != test_input)
+    {
+        ck_assert_msg(0 == memcmp(input_copy, test_input, SUDO_BOARD_LEN),
+                      "validate_board() modified its input");
+    }
+
+    // DONE
+    return;
+}
+
+
+int main(void)
+{
+    // LOCAL VARIABLES
+    int errnum = CANARY_INT;       // Results of execution
+    int number_failed = 0;         // Number of test cases that failed
+    Suite *suite = NULL;           // Test suite
+    SRunner *suite_runner = NULL;  // Test suite runner
+    // Relative path for this test case's input
+    char log_rel_path[] = { "./code/test/test_output/check_sudo_validation_validate_board.log" };
+    // Absolute path for log_rel_path as resolved against the repo name
+    char *log_abs_path = resolve_to_repo(SUDO_REPO_NAME, log_rel_path, false, &errnum);
+
+    // SETUP
+    suite = create_test_suite();
+    suite_runner = srunner_create(suite);
+    srunner_set_log(suite_runner, log_abs_path);
+
+    // RUN IT
+    srunner_run_all(suite_runner, CK_NORMAL);
+    number_failed = srunner_ntests_failed(suite_runner);
+
+    // CLEANUP
+    srunner_free(suite_runner);
+    free_devops_mem((void **)&log_abs_path);
+
+    // DONE
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}